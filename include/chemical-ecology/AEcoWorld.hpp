@@ -4,9 +4,21 @@
 #include <string>
 #include <cmath>
 #include <sys/stat.h>
+#include <unistd.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
 #include <algorithm>
 #include <functional>
 #include <limits>
+#include <map>
+#include <set>
+#include <chrono>
+#include <mutex>
+#include <future>
+#include <utility>
+#include <filesystem>
 
 #include "emp/Evolve/World.hpp"
 #include "emp/math/distances.hpp"
@@ -22,8 +34,14 @@
 #include "chemical-ecology/CommunityStructure.hpp"
 #include "chemical-ecology/RecordedCommunitySummarizer.hpp"
 #include "chemical-ecology/RecordedCommunitySet.hpp"
+#include "chemical-ecology/StabilizationTelemetry.hpp"
+#include "chemical-ecology/AssemblyStateGraph.hpp"
 #include "chemical-ecology/Config.hpp"
 #include "chemical-ecology/utils/graph_utils.hpp"
+#include "chemical-ecology/utils/thread_utils.hpp"
+#include "chemical-ecology/utils/serialization_utils.hpp"
+#include "chemical-ecology/utils/random_utils.hpp"
+#include "chemical-ecology/utils/score_utils.hpp"
 #include "chemical-ecology/InteractionMatrix.hpp"
 
 namespace chemical_ecology {
@@ -40,7 +58,7 @@ namespace chemical_ecology {
 /// Class that helps to manage world community summary files
 class WorldCommunitySummaryFile {
 public:
-  using community_set_t = RecordedCommunitySet<emp::vector<double>>;
+  using community_set_t = RecordedCommunitySet<summary_counts_t>;
 protected:
   emp::DataFile summary_file;
   size_t community_id = 0;
@@ -50,15 +68,15 @@ protected:
   emp::Ptr<const community_set_t> cur_assembly_communities;
   emp::Ptr<const community_set_t> cur_adaptive_communities;
 
-  void Setup() {
+  void Setup(bool print_header) {
     // current update
     summary_file.AddVar(cur_update, "update", "Model update");
 
     // proportion
     summary_file.AddFun<double>(
       [this]() -> double {
-        emp_assert(emp::Sum(cur_world_communities->GetCommunityCounts()) > 0);
-        return (double)cur_world_communities->GetCommunityCount(community_id) / (double)emp::Sum(cur_world_communities->GetCommunityCounts());
+        emp_assert(cur_world_communities->GetTotalCount() > 0);
+        return (double)cur_world_communities->GetCommunityCount(community_id) / (double)cur_world_communities->GetTotalCount();
       },
       "proportion",
       "Proportion of cells where this particular community was found"
@@ -77,7 +95,7 @@ protected:
     summary_file.AddFun<size_t>(
       [this]() -> size_t {
         const auto& summary = cur_world_communities->GetCommunitySummary(community_id);
-        return summary.counts.size();
+        return summary.GetNumPossibleSpecies();
       },
       "num_possible_species"
     );
@@ -86,7 +104,7 @@ protected:
     summary_file.AddFun<std::string>(
       [this]() -> std::string {
         const auto& summary = cur_world_communities->GetCommunitySummary(community_id);
-        return emp::to_string(summary.counts);
+        return emp::to_string(summary.GetReportedCounts());
       },
       "species_counts"
     );
@@ -95,7 +113,7 @@ protected:
     summary_file.AddFun<std::string>(
       [this]() -> std::string {
         const auto& summary = cur_world_communities->GetCommunitySummary(community_id);
-        return emp::to_string(summary.present_species_ids);
+        return emp::to_string(summary.presence->present_species_ids);
       },
       "present_species_ids"
     );
@@ -104,7 +122,7 @@ protected:
     summary_file.AddFun<std::string>(
       [this]() -> std::string {
         const auto& summary = cur_world_communities->GetCommunitySummary(community_id);
-        return emp::to_string(summary.present);
+        return emp::to_string(summary.presence->present);
       },
       "present_species"
     );
@@ -129,7 +147,7 @@ protected:
     summary_file.AddFun<double>(
       [this]() -> double {
         const auto& world_summary = cur_world_communities->GetCommunitySummary(community_id);
-        emp_assert(emp::Sum(cur_adaptive_communities->GetCommunityCounts()) > 0);
+        emp_assert(cur_adaptive_communities->GetTotalCount() > 0);
         const auto adaptive_id = cur_adaptive_communities->GetCommunityID(world_summary);
         return (adaptive_id) ? cur_adaptive_communities->GetCommunityProportion(adaptive_id.value()) : 0.0;
       },
@@ -139,7 +157,7 @@ protected:
     summary_file.AddFun<double>(
       [this]() -> double {
         const auto& world_summary = cur_world_communities->GetCommunitySummary(community_id);
-        emp_assert(emp::Sum(cur_assembly_communities->GetCommunityCounts()) > 0);
+        emp_assert(cur_assembly_communities->GetTotalCount() > 0);
         const auto assembly_id = cur_assembly_communities->GetCommunityID(world_summary);
         return (assembly_id) ?
           cur_assembly_communities->GetCommunityProportion(assembly_id.value()) :
@@ -151,8 +169,8 @@ protected:
     summary_file.AddFun<std::string>(
       [this]() -> std::string {
         const auto& world_summary = cur_world_communities->GetCommunitySummary(community_id);
-        emp_assert(emp::Sum(cur_assembly_communities->GetCommunityCounts()) > 0);
-        emp_assert(emp::Sum(cur_adaptive_communities->GetCommunityCounts()) > 0);
+        emp_assert(cur_assembly_communities->GetTotalCount() > 0);
+        emp_assert(cur_adaptive_communities->GetTotalCount() > 0);
         const auto assembly_id = cur_assembly_communities->GetCommunityID(world_summary);
         const auto adaptive_id = cur_adaptive_communities->GetCommunityID(world_summary);
         const double assembly_prop = (assembly_id) ?
@@ -171,20 +189,20 @@ protected:
     summary_file.AddFun<std::string>(
       [this]() -> std::string {
         const auto& world_summary = cur_world_communities->GetCommunitySummary(community_id);
-        emp_assert(emp::Sum(cur_assembly_communities->GetCommunityCounts()) > 0);
-        emp_assert(emp::Sum(cur_adaptive_communities->GetCommunityCounts()) > 0);
+        emp_assert(cur_assembly_communities->GetTotalCount() > 0);
+        emp_assert(cur_adaptive_communities->GetTotalCount() > 0);
         const auto assembly_id = cur_assembly_communities->GetCommunityID(world_summary);
         const auto adaptive_id = cur_adaptive_communities->GetCommunityID(world_summary);
         double assembly_prop = (assembly_id) ?
           cur_assembly_communities->GetSmoothedCommunityProportion(assembly_id.value()) :
           0.0;
         if (assembly_prop == 0) 
-          assembly_prop = 1/((double)emp::Sum(cur_assembly_communities->GetCommunityCounts())+cur_assembly_communities->GetCommunityCounts().size());
+          assembly_prop = cur_assembly_communities->GetSmoothedAbsentCommunityProportion();
         double adaptive_prop = (adaptive_id) ?
           cur_adaptive_communities->GetSmoothedCommunityProportion(adaptive_id.value()) :
           0.0;
         if (adaptive_prop == 0) 
-          adaptive_prop = 1/((double)emp::Sum(cur_adaptive_communities->GetCommunityCounts())+cur_adaptive_communities->GetCommunityCounts().size());
+          adaptive_prop = cur_adaptive_communities->GetSmoothedAbsentCommunityProportion();
         return (assembly_prop != 0) ?
           emp::to_string(adaptive_prop / assembly_prop) :
           "error";
@@ -201,14 +219,16 @@ protected:
       "Dom_map"
     );
 
-    summary_file.PrintHeaderKeys();
+    if (print_header) summary_file.PrintHeaderKeys();
   }
 
 public:
-  WorldCommunitySummaryFile(const std::string& file_path) :
-    summary_file(file_path)
+  // Writes to the given (externally owned) stream; the header can be skipped when picking
+  // up a file that already has one (e.g., resuming from a checkpoint)
+  WorldCommunitySummaryFile(std::ostream& os, bool print_header=true) :
+    summary_file(os)
   {
-    Setup();
+    Setup(print_header);
   }
 
   void Update(
@@ -268,6 +288,148 @@ public:
     { }
   };
 
+  // Summaries of a single analyzed cell (one per community summary method)
+  struct CellCommunitySummaries {
+    RecordedCommunitySummary raw;
+    RecordedCommunitySummary pwip;
+    RecordedCommunitySummary ranked;
+    RecordedCommunitySummary ranked_threshold;
+  };
+
+  // The recorded community sets filled in by a single community analysis
+  // (one set per community summary method)
+  struct RecordedCommunitySets {
+    using set_t = RecordedCommunitySet<summary_counts_t>;
+    using ranked_set_t = RecordedCommunitySet<summary_ranks_t>;
+    set_t raw;                     // Raw species counts
+    set_t pwip;                    // Species present with valid interaction paths to other present species
+    ranked_set_t ranked;           // Species dominance rankings
+    ranked_set_t ranked_threshold; // Species dominance rankings (species below THRESHOLD_VALUE rounded down)
+
+    RecordedCommunitySets(
+      const set_t::summary_key_fun_t& key_fun,
+      const ranked_set_t::summary_key_fun_t& ranked_key_fun
+    ) :
+      raw(key_fun),
+      pwip(key_fun),
+      ranked(ranked_key_fun),
+      ranked_threshold(ranked_key_fun)
+    { }
+
+    // Uses the standard summary keys (see GetCountsKey and GetRanksKey)
+    RecordedCommunitySets() : RecordedCommunitySets(GetCountsKey, GetRanksKey) { }
+
+    // Communities are identified by their counts
+    static const summary_counts_t& GetCountsKey(const RecordedCommunitySummary& summary) {
+      return summary.counts;
+    }
+
+    // Ranked communities are identified by their (compact) ranks
+    static const summary_ranks_t& GetRanksKey(const RecordedCommunitySummary& summary) {
+      return summary.ranks;
+    }
+
+    void Clear() {
+      raw.Clear();
+      pwip.Clear();
+      ranked.Clear();
+      ranked_threshold.Clear();
+    }
+
+    // Bound the number of communities kept in each set (see RecordedCommunitySet::SetCapacity)
+    void SetCapacity(size_t max_communities, size_t counters_per_row=0) {
+      raw.SetCapacity(max_communities, counters_per_row);
+      pwip.SetCapacity(max_communities, counters_per_row);
+      ranked.SetCapacity(max_communities, counters_per_row);
+      ranked_threshold.SetCapacity(max_communities, counters_per_row);
+    }
+
+    void Add(const CellCommunitySummaries& summaries, size_t count=1) {
+      raw.Add(summaries.raw, count);
+      pwip.Add(summaries.pwip, count);
+      ranked.Add(summaries.ranked, count);
+      ranked_threshold.Add(summaries.ranked_threshold, count);
+    }
+
+    // Adds everything recorded in other to these sets
+    void Merge(const RecordedCommunitySets& other) {
+      raw.Merge(other.raw);
+      pwip.Merge(other.pwip);
+      ranked.Merge(other.ranked);
+      ranked_threshold.Merge(other.ranked_threshold);
+    }
+
+    void Serialize(std::ostream& os) const {
+      raw.Serialize(os);
+      pwip.Serialize(os);
+      ranked.Serialize(os);
+      ranked_threshold.Serialize(os);
+    }
+
+    bool Deserialize(std::istream& is) {
+      return raw.Deserialize(is)
+        && pwip.Deserialize(is)
+        && ranked.Deserialize(is)
+        && ranked_threshold.Deserialize(is);
+    }
+  };
+
+  // Recorded community sets exported at the end of a run (EXPORT_RECORDED_COMMUNITIES).
+  // Exports from runs with the same interaction matrix (e.g., runs with different seeds) can be
+  // merged into one (see source/merge_communities.cpp).
+  struct RecordedCommunityExport {
+    uint64_t interactions_hash = 0;   // Identifies the interaction matrix the communities came from
+    uint64_t num_species = 0;
+    uint64_t num_runs = 0;            // Number of runs merged into this export
+    RecordedCommunitySets assembly;
+    RecordedCommunitySets adaptive;
+    RecordedCommunitySets world;      // World communities at the end of the run
+
+    static uint64_t GetInteractionsHash(const emp::vector<emp::vector<double>>& interaction_matrix) {
+      utils::Hasher hasher;
+      hasher.Add(interaction_matrix);
+      return hasher.GetHash();
+    }
+
+    // Can other be merged into this export?
+    bool IsCompatible(const RecordedCommunityExport& other) const {
+      return interactions_hash == other.interactions_hash && num_species == other.num_species;
+    }
+
+    // Adds everything recorded in other to this export (community counts for matching
+    // communities are summed)
+    void Merge(const RecordedCommunityExport& other) {
+      emp_assert(IsCompatible(other));
+      num_runs += other.num_runs;
+      assembly.Merge(other.assembly);
+      adaptive.Merge(other.adaptive);
+      world.Merge(other.world);
+    }
+
+    void Serialize(std::ostream& os) const {
+      utils::WriteBinary(os, std::string("a-eco-recorded-communities"));
+      utils::WriteBinary(os, interactions_hash);
+      utils::WriteBinary(os, num_species);
+      utils::WriteBinary(os, num_runs);
+      assembly.Serialize(os);
+      adaptive.Serialize(os);
+      world.Serialize(os);
+    }
+
+    // Read export written by Serialize. Returns false if stream did not contain a full export.
+    bool Deserialize(std::istream& is) {
+      std::string magic;
+      return utils::ReadBinary(is, magic)
+        && magic == "a-eco-recorded-communities"
+        && utils::ReadBinary(is, interactions_hash)
+        && utils::ReadBinary(is, num_species)
+        && utils::ReadBinary(is, num_runs)
+        && assembly.Deserialize(is)
+        && adaptive.Deserialize(is)
+        && world.Deserialize(is);
+    }
+  };
+
 private:
 
   // The matrix of interactions between types
@@ -280,8 +442,9 @@ private:
   size_t world_size = 0;
 
   // A random number generator for all our random number
-  // generating needs
-  emp::Random rnd;
+  // generating needs (saved in checkpoints)
+  utils::SerializableRandom rnd;
+  int run_seed = 0; // Seed rnd started from (replicate streams derive from it)
 
   // All configuration information is stored in config
   emp::Ptr<chemical_ecology::Config> config = nullptr;
@@ -293,7 +456,7 @@ private:
 
   size_t world_update;
   size_t analysis_update; // Update inside of "analysis"
-  size_t stochastic_rep;
+  size_t stochastic_rep = 0;
 
   // Initialize vector that keeps track of grid
   world_t world;
@@ -305,32 +468,80 @@ private:
   // Used to track activation order of positions in the world
   emp::vector<size_t> position_activation_order;
 
-  emp::Ptr<RecordedCommunitySummarizer> community_summarizer_raw;         // Uses raw species counts.
-  emp::Ptr<RecordedCommunitySummarizer> community_summarizer_pwip;        // Keeps all species present with valid interaction paths to other present species
-  emp::Ptr<RecordedCommunitySummarizer> community_summarizer_ranked;      // Will keep sepcies as dominance rankings
-  emp::Ptr<RecordedCommunitySummarizer> community_summarizer_ranked_threshold;      // Will keep sepcies as rounded dominance rankings
-
-  RecordedCommunitySet<emp::vector<double>>::summary_key_fun_t recorded_comm_key_fun;
-  emp::Ptr<RecordedCommunitySet<emp::vector<double>>> recorded_communities_assembly_raw;
-  emp::Ptr<RecordedCommunitySet<emp::vector<double>>> recorded_communities_adaptive_raw;
-  emp::Ptr<RecordedCommunitySet<emp::vector<double>>> recorded_communities_assembly_pwip;
-  emp::Ptr<RecordedCommunitySet<emp::vector<double>>> recorded_communities_adaptive_pwip;
-  emp::Ptr<RecordedCommunitySet<emp::vector<double>>> recorded_communities_assembly_ranked;
-  emp::Ptr<RecordedCommunitySet<emp::vector<double>>> recorded_communities_adaptive_ranked;
-  emp::Ptr<RecordedCommunitySet<emp::vector<double>>> recorded_communities_assembly_ranked_threshold;
-  emp::Ptr<RecordedCommunitySet<emp::vector<double>>> recorded_communities_adaptive_ranked_threshold;
+  // Between-cell events proposed by a single cell (used by two-phase between-cell updates)
+  struct CellProposal {
+    emp::vector<size_t> group_repro_schedule; // This cell's sub-community group repro schedule
+    emp::vector<size_t> repro_targets;        // Positions this cell reproduces into (in order)
+    bool clear = false;                       // Is this cell cleared?
+    emp::vector<size_t> seeded_types;         // Types seeded into this cell
+  };
+
+  // A single operation on one cell of the next world, caused by the cell at position src
+  struct CellOp {
+    enum class op_t { REPRO, CLEAR, DIFFUSE_IN, DIFFUSE_OUT, SEED };
+    op_t type;
+    size_t src;
+  };
+
+  // Per-world state for two-phase between-cell updates
+  struct CellInteractionBuffers {
+    emp::vector<utils::SerializableRandom> cell_rnds; // One random number stream per cell
+    emp::vector<CellProposal> proposals;          // Proposals (by position)
+    emp::vector<emp::vector<CellOp>> cell_ops;    // Operations on each cell of the next world (in activation order)
+  };
+
+  // Main world state for two-phase between-cell updates (PARALLEL_GROUP_REPRO)
+  CellInteractionBuffers cell_interaction_buffers;
+
+  emp::Ptr<RecordedCommunitySummarizerGroup> community_summarizers; // Raw counts, species present with valid interaction paths, and dominance rankings
+  PresenceSummaryCache presence_summary_cache;    // Presence-derived summary info (shared by all community summaries)
+
+  RecordedCommunitySet<summary_counts_t>::summary_key_fun_t recorded_comm_key_fun;
+  RecordedCommunitySet<summary_ranks_t>::summary_key_fun_t recorded_comm_ranks_key_fun;
+  emp::Ptr<RecordedCommunitySets> recorded_communities_assembly;
+  emp::Ptr<RecordedCommunitySets> recorded_communities_adaptive;
+  emp::Ptr<RecordedCommunitySets> recorded_communities_world;
 
   // Set up data tracking
   std::string output_dir;
+  // Output files that are appended to throughout a run (owned here so that a run resumed
+  // from a checkpoint can pick up each file where the checkpoint left it)
+  emp::vector<std::pair<std::string, emp::Ptr<std::ofstream>>> output_streams;
+
+  // Checkpointing (see CHECKPOINT_INTERVAL)
+  bool resuming = false;                              // Is this run picking up from a checkpoint?
+  size_t resume_update = 0;                           // First update to run after resuming
+  bool resumed_stochastic_analysis = false;           // Did the checkpoint's assembly/adaptive results carry over?
+  std::map<std::string, uint64_t> resume_output_sizes; // Output file sizes when the checkpoint was written
   emp::Ptr<emp::DataFile> data_file = nullptr;
   emp::Ptr<emp::DataFile> assembly_data_file = nullptr;
   emp::Ptr<emp::DataFile> adaptive_data_file = nullptr;
+  std::mutex model_recording_mutex; // Guards assembly/adaptive model recording (replicates may run concurrently)
+
+  // Stochastic analysis replicates (assembly/adaptive models) can run alongside the main world
+  std::future<void> stochastic_analysis_task;       // Valid while replicates run in the background
+  emp::vector<StabilizationStats> rep_assembly_stats; // Per-replicate stats, recorded once replicates are done
+  emp::vector<StabilizationStats> rep_adaptive_stats;
+  size_t stochastic_analysis_reps_used = 0;      // Number of replicates behind the assembly/adaptive results
+  bool stochastic_analysis_reported = false;     // Have replicate stats/config been written out?
+  StabilizationStats assembly_graph_stats;       // Stabilizations done while building the assembly-state graph
+  // World pwip community sets (by update) waiting on replicate results to be written to the world summary file
+  emp::vector<std::pair<size_t, WorldCommunitySummaryFile::community_set_t>> pending_world_communities_pwip;
 
   emp::Ptr<WorldCommunitySummaryFile> world_community_summary_pwip_file = nullptr; // Summarizes results from world community analysis
 
-  world_t worldState;
-  world_t assemblyWorldState;
-  world_t adaptiveWorldState;
+  // Stabilization telemetry
+  emp::Ptr<emp::DataFile> stabilization_file = nullptr;    // One line per analyzed world
+  std::string stabilization_source;                         // Source of the stats currently being recorded
+  size_t stabilization_rep = 0;                             // Replicate of the stats currently being recorded
+  size_t stabilization_update = 0;                          // Update of the stats currently being recorded
+  emp::Ptr<const StabilizationStats> cur_stabilization_stats = nullptr; // Unowned
+  std::map<std::string, StabilizationStats> stabilization_totals;       // Run totals (by source)
+
+  // Worlds being written out by the data files (unowned; only set while a data file is updated)
+  emp::Ptr<const world_t> recorded_world = nullptr;
+  emp::Ptr<const world_t> recorded_assembly_world = nullptr;
+  emp::Ptr<const world_t> recorded_adaptive_world = nullptr;
 
   // Configures spatial structure based on world configuration.
   void SetupSpatialStructure();
@@ -344,6 +555,73 @@ private:
 
   void SetupCommunitySummarizers();
 
+  // Streams each cell of the given world through stabilization, ranking, and summarization,
+  // adding the resulting summaries directly to the given recorded community sets.
+  // Cells are analyzed in contiguous chunks on up to num_threads threads, each chunk into its
+  // own partial sets; partial sets are merged in chunk order, so results (including community
+  // IDs) are the same as analyzing cells one at a time.
+  void AnalyzeCommunities(
+    const world_t& analysis_world,
+    RecordedCommunitySets& recorded_communities,
+    StabilizationStats& stabilization_stats,
+    size_t num_threads=1
+  );
+
+  // Number of contiguous chunks to split num_items cells into for concurrent analysis
+  static size_t GetNumAnalysisChunks(size_t num_items, size_t num_threads) {
+    // A few chunks per thread, so uneven stabilization times balance across threads
+    return std::min(num_items, (utils::GetNumThreads(num_threads) > 1) ? 4 * utils::GetNumThreads(num_threads) : 1);
+  }
+
+  // Calls fun(chunk, begin, end, chunk_stats) for each of num_chunks contiguous chunks of
+  // [0, num_items) on up to num_threads threads, then appends each chunk's stabilization stats
+  // to stabilization_stats in chunk order.
+  template<typename FUN>
+  void ForEachAnalysisChunk(
+    size_t num_items,
+    size_t num_chunks,
+    size_t num_threads,
+    StabilizationStats& stabilization_stats,
+    FUN&& fun
+  ) {
+    emp::vector<StabilizationStats> chunk_stats(num_chunks);
+    utils::ParallelFor(0, num_chunks, num_threads, [&](size_t chunk) {
+      fun(chunk, chunk * num_items / num_chunks, (chunk + 1) * num_items / num_chunks, chunk_stats[chunk]);
+    });
+    for (const auto& stats : chunk_stats) stabilization_stats.Append(stats);
+  }
+
+  // Stabilizes, ranks, and summarizes a single cell. stable_cell should hold the cell's
+  // starting state and is stabilized in place. Stabilization work is recorded (under the
+  // given position) in stabilization_stats.
+  void AnalyzeCell(
+    size_t pos,
+    emp::vector<double>& stable_cell,
+    CellCommunitySummaries& summaries,
+    StabilizationStats& stabilization_stats
+  );
+
+  // Summarize an already-stable cell (as AnalyzeCell does after stabilizing)
+  void SummarizeStableCell(
+    const emp::vector<double>& stable_cell,
+    CellCommunitySummaries& summaries
+  );
+
+  // Write stabilization stats for one analysis to the stabilization file and add them
+  // to the run totals.
+  void RecordStabilization(
+    const std::string& source,
+    size_t rep,
+    size_t update,
+    const StabilizationStats& stats
+  );
+
+  // Print run totals of stabilization stats
+  void PrintStabilizationSummary(std::ostream& os=std::cout) const;
+
+  // Print how approximate assembly/adaptive community counts are (RECORDED_COMMUNITY_CAPACITY)
+  void PrintApproximateCountingSummary(std::ostream& os=std::cout) const;
+
   void AnalyzeWorldCommunities(
     bool output_snapshots = false
   );
@@ -375,27 +653,25 @@ public:
   AEcoWorld() = default;
 
   ~AEcoWorld() {
+    // Background replicates may still be using world members
+    if (stochastic_analysis_task.valid()) stochastic_analysis_task.wait();
     if (data_file != nullptr) data_file.Delete();
     if (assembly_data_file != nullptr) assembly_data_file.Delete();
     if (adaptive_data_file != nullptr) adaptive_data_file.Delete();
-    if (community_summarizer_raw != nullptr) community_summarizer_raw.Delete();
-    if (community_summarizer_pwip != nullptr) community_summarizer_pwip.Delete();
-    if (community_summarizer_ranked != nullptr) community_summarizer_ranked.Delete();
-    if (community_summarizer_ranked_threshold != nullptr) community_summarizer_ranked_threshold.Delete();
+    if (community_summarizers != nullptr) community_summarizers.Delete();
     if (world_community_summary_pwip_file != nullptr) world_community_summary_pwip_file.Delete();
+    if (stabilization_file != nullptr) stabilization_file.Delete();
+    // Data files write to these streams, so they go last
+    for (auto& output_stream : output_streams) output_stream.second.Delete();
 
-    if (recorded_communities_assembly_raw != nullptr) recorded_communities_assembly_raw.Delete();
-    if (recorded_communities_adaptive_raw != nullptr) recorded_communities_adaptive_raw.Delete();
-    if (recorded_communities_assembly_pwip != nullptr) recorded_communities_assembly_pwip.Delete();
-    if (recorded_communities_adaptive_pwip != nullptr) recorded_communities_adaptive_pwip.Delete();
-    if (recorded_communities_assembly_ranked != nullptr) recorded_communities_assembly_ranked.Delete();
-    if (recorded_communities_adaptive_ranked != nullptr) recorded_communities_adaptive_ranked.Delete();
-    if (recorded_communities_assembly_ranked_threshold != nullptr) recorded_communities_assembly_ranked_threshold.Delete();
-    if (recorded_communities_adaptive_ranked_threshold != nullptr) recorded_communities_adaptive_ranked_threshold.Delete();
+    if (recorded_communities_assembly != nullptr) recorded_communities_assembly.Delete();
+    if (recorded_communities_adaptive != nullptr) recorded_communities_adaptive.Delete();
+    if (recorded_communities_world != nullptr) recorded_communities_world.Delete();
   }
 
-  // Setup the world according to the specified configuration
-  void Setup(config_t& cfg) {
+  // Setup the world according to the specified configuration.
+  // If resume is true, the world picks up from the latest checkpoint in OUTPUT_DIR (if any).
+  void Setup(config_t& cfg, bool resume=false) {
 
     // Store cfg for future reference
     config = &cfg;
@@ -407,6 +683,7 @@ public:
     // Set seed to configured value for reproducibility
     // NOTE (@AML): Make sure to be using updated version of Empirical with patch for ResetSeed function!
     rnd.ResetSeed(config->SEED());
+    run_seed = rnd.GetSeed();
 
     // Setup spatial structure (configures world size)
     world_size = 0; // World size not valid until after setting up spatial structure
@@ -467,10 +744,26 @@ public:
       0
     );
 
+    // Two-phase between-cell updates give each cell its own random number stream
+    if (config->PARALLEL_GROUP_REPRO()) {
+      SetupCellInteractionBuffers(cell_interaction_buffers, DrawCellSeedBase(rnd));
+    }
+
     // Configure community summarizers (used to report summaries of recorded communities)
     // NOTE: should be called after community structure has been configured
     SetupCommunitySummarizers();
 
+    if (config->ASSEMBLY_ANALYSIS_MODE() != "stochastic" && config->ASSEMBLY_ANALYSIS_MODE() != "exhaustive") {
+      std::cout << "Unknown assembly analysis mode: " << config->ASSEMBLY_ANALYSIS_MODE() << std::endl;
+      std::cout << "Exiting." << std::endl;
+      exit(-1);
+    }
+    if (config->ASSEMBLY_ANALYSIS_MODE() == "exhaustive" && N_TYPES > AssemblyStateGraph::MAX_SPECIES) {
+      std::cout << "Exhaustive assembly analysis supports at most " << AssemblyStateGraph::MAX_SPECIES << " species." << std::endl;
+      std::cout << "Exiting." << std::endl;
+      exit(-1);
+    }
+
     // Configure output directory path, create directory
     output_dir = config->OUTPUT_DIR();
     mkdir(output_dir.c_str(), ACCESSPERMS);
@@ -478,49 +771,102 @@ public:
         output_dir += '/';
     }
 
+    // Pick up from the latest checkpoint?
+    // NOTE: must happen before output files are opened (and before the config snapshot)
+    resuming = resume && LoadCheckpoint();
+
     // NOTE (@AML): Could merge data_file and stochastic_data_file => same information being printed for each
-    data_file = emp::NewPtr<emp::DataFile>(output_dir + "a-eco_data.csv");
+    data_file = emp::NewPtr<emp::DataFile>(OpenOutputStream(output_dir + "a-eco_data.csv"));
     data_file->AddVar(world_update, "Time", "Time");
     data_file->AddFun<std::string>(
-      [this]() -> std::string { return emp::to_string(worldState); },
+      [this]() -> std::string { return emp::to_string(*recorded_world); },
       "worldState",
       "world state"
     );
     data_file->SetTimingRepeat(config->OUTPUT_RESOLUTION());
-    data_file->PrintHeaderKeys();
+    if (!resuming) data_file->PrintHeaderKeys();
 
     // Assembly file
-    assembly_data_file = emp::NewPtr<emp::DataFile>(output_dir + "a-eco_assembly_model_data.csv");
+    assembly_data_file = emp::NewPtr<emp::DataFile>(OpenOutputStream(output_dir + "a-eco_assembly_model_data.csv"));
     assembly_data_file->AddVar(stochastic_rep, "replicate", "Replicate of model");
     assembly_data_file->AddVar(analysis_update, "Time", "Time");
     assembly_data_file->AddFun<std::string>(
-      [this]() -> std::string { return emp::to_string(assemblyWorldState); },
+      [this]() -> std::string { return emp::to_string(*recorded_assembly_world); },
       "assemblyWorldState",
       "assembly world state"
     );
     assembly_data_file->SetTimingRepeat(config->OUTPUT_RESOLUTION());
-    assembly_data_file->PrintHeaderKeys();
+    if (!resuming) assembly_data_file->PrintHeaderKeys();
 
     // Adaptive file
-    adaptive_data_file = emp::NewPtr<emp::DataFile>(output_dir + "a-eco_adaptive_model_data.csv");
+    adaptive_data_file = emp::NewPtr<emp::DataFile>(OpenOutputStream(output_dir + "a-eco_adaptive_model_data.csv"));
     adaptive_data_file->AddVar(stochastic_rep, "replicate", "Replicate of model");
     adaptive_data_file->AddVar(analysis_update, "Time", "Time");
     adaptive_data_file->AddFun<std::string>(
-      [this]() -> std::string { return emp::to_string(adaptiveWorldState); },
+      [this]() -> std::string { return emp::to_string(*recorded_adaptive_world); },
       "adaptiveWorldState",
       "adaptive world state"
     );
     adaptive_data_file->SetTimingRepeat(config->OUTPUT_RESOLUTION());
-    adaptive_data_file->PrintHeaderKeys();
+    if (!resuming) adaptive_data_file->PrintHeaderKeys();
 
     // Setup world summary file
     // NOTE (@AML): This should happen wherever we decide to configure the set of
     //              community summary methods. We might want different summary files
     //              for each summary method.
     world_community_summary_pwip_file = emp::NewPtr<WorldCommunitySummaryFile>(
-      output_dir + "world_summary_pwip.csv"
+      OpenOutputStream(output_dir + "world_summary_pwip.csv"),
+      !resuming
     );
 
+    // Stabilization telemetry file
+    stabilization_file = emp::NewPtr<emp::DataFile>(OpenOutputStream(output_dir + "stabilization.csv"));
+    stabilization_file->AddVar(stabilization_source, "source", "Which model was stabilized");
+    stabilization_file->AddVar(stabilization_rep, "replicate", "Replicate of model");
+    stabilization_file->AddVar(stabilization_update, "update", "Model update");
+    stabilization_file->AddFun<size_t>(
+      [this]() -> size_t { return cur_stabilization_stats->num_cells; },
+      "num_cells"
+    );
+    stabilization_file->AddFun<size_t>(
+      [this]() -> size_t { return cur_stabilization_stats->num_not_converged; },
+      "num_not_converged",
+      "Number of cells that reached CELL_STABILIZATION_UPDATES without converging"
+    );
+    stabilization_file->AddFun<double>(
+      [this]() -> double { return cur_stabilization_stats->GetMeanUpdates(); },
+      "mean_cell_updates"
+    );
+    stabilization_file->AddFun<size_t>(
+      [this]() -> size_t { return cur_stabilization_stats->max_cell_updates; },
+      "max_cell_updates"
+    );
+    stabilization_file->AddFun<size_t>(
+      [this]() -> size_t { return cur_stabilization_stats->total_updates; },
+      "total_updates"
+    );
+    stabilization_file->AddFun<double>(
+      [this]() -> double { return cur_stabilization_stats->seconds; },
+      "seconds"
+    );
+    stabilization_file->AddFun<std::string>(
+      [this]() -> std::string { return emp::to_string(cur_stabilization_stats->update_histogram); },
+      "update_histogram",
+      "Number of cells needing 0, 1, [2,4), [4,8), ... updates"
+    );
+    stabilization_file->AddFun<std::string>(
+      [this]() -> std::string { return emp::to_string(cur_stabilization_stats->not_converged_positions); },
+      "not_converged_positions"
+    );
+    if (config->RECORD_STABILIZATION_CELL_UPDATES()) {
+      stabilization_file->AddFun<std::string>(
+        [this]() -> std::string { return emp::to_string(cur_stabilization_stats->cell_updates); },
+        "cell_updates",
+        "Updates needed by each stabilized cell (in stabilization order)"
+      );
+    }
+    if (!resuming) stabilization_file->PrintHeaderKeys();
+
     // Output a snapshot of identified subcommunities
     SnapshotSubCommunities();
 
@@ -532,56 +878,41 @@ public:
   // all time steps
   void Run() {
 
-    // Run N replicates of the adaptive model and assembly model.
-    // Save recorded summaries to use when summarizing the world.
-    for (size_t i = 0; i < config->STOCHASTIC_ANALYSIS_REPS(); ++i) {
-      // Adaptive and assembly data tracking
-      stochastic_rep = i;
-
-      // Run assembly model
-      world_t assemblyModel = AssemblyModel(config->UPDATES(), config->PROB_CLEAR(), config->SEEDING_PROB());
-      world_t stableAssemblyModel = GenStabilizedWorld(assemblyModel, config->CELL_STABILIZATION_UPDATES());
-
-      // Run adaptive model
-      world_t adaptiveModel = AdaptiveModel(config->UPDATES(), config->PROB_CLEAR(), config->SEEDING_PROB());
-      world_t stableAdaptiveModel = GenStabilizedWorld(adaptiveModel, config->CELL_STABILIZATION_UPDATES());
-
-      world_t rankedAssemblyModel = GenRankedWorld(stableAssemblyModel, false);
-      world_t rankedAdaptiveModel = GenRankedWorld(stableAdaptiveModel, false);
-      world_t rankedThresholdAssemblyModel = GenRankedWorld(stableAssemblyModel, true);
-      world_t rankedThresholdAdaptiveModel = GenRankedWorld(stableAdaptiveModel, true);
-
-      // Add summarized recorded communities to sets
-      recorded_communities_assembly_raw->Add(
-        community_summarizer_raw->SummarizeAll(stableAssemblyModel)
-      );
-      recorded_communities_assembly_pwip->Add(
-        community_summarizer_pwip->SummarizeAll(stableAssemblyModel)
-      );
-      recorded_communities_assembly_ranked->Add(
-        community_summarizer_ranked->SummarizeAll(rankedAssemblyModel)
-      );
-      recorded_communities_assembly_ranked_threshold->Add(
-        community_summarizer_ranked_threshold->SummarizeAll(rankedThresholdAssemblyModel)
-      );
-      recorded_communities_adaptive_raw->Add(
-        community_summarizer_raw->SummarizeAll(stableAdaptiveModel)
-      );
-      recorded_communities_adaptive_pwip->Add(
-        community_summarizer_pwip->SummarizeAll(stableAdaptiveModel)
-      );
-      recorded_communities_adaptive_ranked->Add(
-        community_summarizer_ranked_threshold->SummarizeAll(rankedAdaptiveModel)
-      );
-      recorded_communities_adaptive_ranked_threshold->Add(
-        community_summarizer_ranked_threshold->SummarizeAll(rankedThresholdAdaptiveModel)
-      );
+    const size_t checkpoint_interval = config->CHECKPOINT_INTERVAL();
+    world_update = resuming ? resume_update : 0;
+    // Stochastic analysis results come with a checkpoint (unless they were run for a
+    // different number of UPDATES)
+    if (!resuming || !resumed_stochastic_analysis) {
+      // Run N replicates of the adaptive model and assembly model.
+      // Save recorded summaries to use when summarizing the world.
+      // These can run in the background: the main world only needs their results once
+      // world communities are reported (see AnalyzeWorldCommunities).
+      const int base_seed = run_seed;
+      if (config->OVERLAP_STOCHASTIC_ANALYSIS()) {
+        stochastic_analysis_task = std::async(
+          std::launch::async,
+          [this, base_seed]() { RunStochasticAnalysis(base_seed); }
+        );
+      } else {
+        RunStochasticAnalysis(base_seed);
+        FinishStochasticAnalysis();
+        if (checkpoint_interval > 0) WriteCheckpoint(world_update);
+      }
     }
 
     // Call update the specified number of times
-    for (world_update = 0; world_update <= config->UPDATES(); ++world_update) {
+    for ( ; world_update <= config->UPDATES(); ++world_update) {
       Update();
+      const bool checkpoint_due = (checkpoint_interval > 0)
+        && (world_update < config->UPDATES())
+        && ((world_update + 1) % checkpoint_interval == 0);
+      if (checkpoint_due) WriteCheckpoint(world_update + 1);
     }
+    FinishStochasticAnalysis();
+    if (config->EXPORT_RECORDED_COMMUNITIES()) ExportRecordedCommunities();
+
+    PrintStabilizationSummary();
+    if (config->RECORDED_COMMUNITY_CAPACITY() > 0) PrintApproximateCountingSummary();
 
     //Print out final state if in verbose mode
     if (config->V()) {
@@ -592,6 +923,560 @@ public:
     }
   }
 
+  // Writes assembly, adaptive, and (final) world recorded community sets to
+  // OUTPUT_DIR/recorded_communities.bin
+  void ExportRecordedCommunities() const {
+    RecordedCommunityExport communities;
+    communities.interactions_hash = RecordedCommunityExport::GetInteractionsHash(interactions.GetInteractions());
+    communities.num_species = N_TYPES;
+    communities.num_runs = 1;
+    communities.assembly = *recorded_communities_assembly;
+    communities.adaptive = *recorded_communities_adaptive;
+    communities.world = *recorded_communities_world;
+    const std::string path = output_dir + "recorded_communities.bin";
+    std::ofstream export_file(path, std::ios::binary);
+    communities.Serialize(export_file);
+    if (!export_file) {
+      std::cout << "Failed to write recorded communities file: " << path << std::endl;
+    }
+  }
+
+  // Opens an output file that is appended to throughout the run.
+  // When resuming, anything written after the checkpoint is dropped and writing picks up
+  // from there.
+  std::ostream& OpenOutputStream(const std::string& path) {
+    auto output_stream = emp::NewPtr<std::ofstream>();
+    if (resuming) {
+      std::error_code error;
+      auto size_it = resume_output_sizes.find(path);
+      if (size_it != resume_output_sizes.end()) {
+        std::filesystem::resize_file(path, size_it->second, error);
+      }
+      if (size_it == resume_output_sizes.end() || error) {
+        std::cout << "Unable to resume output file " << path << " from checkpoint." << std::endl;
+        std::cout << "Exiting." << std::endl;
+        exit(-1);
+      }
+      output_stream->open(path, std::ios::app);
+    } else {
+      output_stream->open(path);
+    }
+    output_streams.emplace_back(path, output_stream);
+    return *output_stream;
+  }
+
+  std::string GetCheckpointPath() const {
+    return output_dir + "checkpoint.bin";
+  }
+
+  // Hash of the settings behind the state a checkpoint holds (runs can only resume from
+  // checkpoints written with the same settings). Settings that do not change that state
+  // are left out, so, e.g., a finished run can be extended by resuming with more UPDATES.
+  uint64_t GetCheckpointKey() const {
+    constexpr uint32_t CHECKPOINT_VERSION = 9;
+    static const std::set<std::string> unkeyed_settings = {
+      "UPDATES", "NUM_THREADS", "CHECKPOINT_INTERVAL", "OVERLAP_STOCHASTIC_ANALYSIS",
+      "BASELINE_CACHE_DIR", "OUTPUT_DIR", "EXPORT_RECORDED_COMMUNITIES", "V"
+    };
+    utils::Hasher hasher;
+    hasher.Add(CHECKPOINT_VERSION);
+    hasher.Add(run_seed);
+    hasher.Add((uint64_t)world_size);
+    for (const auto& entry : *config) {
+      if (unkeyed_settings.count(entry.first)) continue;
+      hasher.Add(entry.first);
+      hasher.Add(emp::to_string(entry.second->GetValue()));
+    }
+    return hasher.GetHash();
+  }
+
+  // Writes everything needed to pick the run back up at next_update to the checkpoint file.
+  // Waits for stochastic analysis results (if still running).
+  void WriteCheckpoint(size_t next_update) {
+    FinishStochasticAnalysis();
+
+    const std::string path = GetCheckpointPath();
+    // Write to a temporary file first, so a run stopped mid-write keeps its previous checkpoint
+    const std::string tmp_path = path + ".tmp";
+    std::ofstream checkpoint_file(tmp_path, std::ios::binary);
+    utils::WriteBinary(checkpoint_file, std::string("a-eco-checkpoint"));
+    utils::WriteBinary(checkpoint_file, GetCheckpointKey());
+    utils::WriteBinary(checkpoint_file, (uint64_t)next_update);
+    utils::WriteBinary(checkpoint_file, (uint64_t)config->UPDATES()); // Assembly/adaptive models ran this long
+    utils::WriteBinary(checkpoint_file, world);
+    utils::WriteBinary(checkpoint_file, position_activation_order);
+    utils::WriteBinary(checkpoint_file, subcommunity_group_repro_schedule);
+    rnd.Serialize(checkpoint_file);
+    // Per-cell streams and schedules (two-phase between-cell updates only; empty otherwise)
+    utils::WriteBinary(checkpoint_file, (uint64_t)cell_interaction_buffers.cell_rnds.size());
+    for (const auto& cell_rnd : cell_interaction_buffers.cell_rnds) cell_rnd.Serialize(checkpoint_file);
+    for (const auto& proposal : cell_interaction_buffers.proposals) {
+      utils::WriteBinary(checkpoint_file, proposal.group_repro_schedule);
+    }
+    utils::WriteBinary(checkpoint_file, (uint64_t)stochastic_analysis_reps_used);
+    recorded_communities_assembly->Serialize(checkpoint_file);
+    recorded_communities_adaptive->Serialize(checkpoint_file);
+    recorded_communities_world->Serialize(checkpoint_file);
+    utils::WriteBinary(checkpoint_file, (uint64_t)stabilization_totals.size());
+    for (const auto& entry : stabilization_totals) {
+      utils::WriteBinary(checkpoint_file, entry.first);
+      entry.second.Serialize(checkpoint_file);
+    }
+    utils::WriteBinary(checkpoint_file, (uint64_t)output_streams.size());
+    for (auto& output_stream : output_streams) {
+      output_stream.second->flush();
+      utils::WriteBinary(checkpoint_file, output_stream.first);
+      utils::WriteBinary(checkpoint_file, (uint64_t)std::filesystem::file_size(output_stream.first));
+    }
+    checkpoint_file.close();
+    if (!checkpoint_file || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+      std::cout << "Failed to write checkpoint " << path << std::endl;
+      std::remove(tmp_path.c_str());
+    }
+  }
+
+  // Loads the checkpoint in the output directory.
+  // Returns false if there is no checkpoint (i.e., the run should start from the beginning).
+  bool LoadCheckpoint() {
+    const std::string path = GetCheckpointPath();
+    std::ifstream checkpoint_file(path, std::ios::binary);
+    if (!checkpoint_file) {
+      std::cout << "No checkpoint found at " << path << "; starting from the beginning." << std::endl;
+      return false;
+    }
+    std::string magic;
+    uint64_t key = 0;
+    uint64_t next_update = 0;
+    uint64_t model_updates = 0;
+    uint64_t num_cell_rnds = 0;
+    uint64_t reps_used = 0;
+    uint64_t num_totals = 0;
+    uint64_t num_output_files = 0;
+    bool loaded = utils::ReadBinary(checkpoint_file, magic)
+      && magic == "a-eco-checkpoint"
+      && utils::ReadBinary(checkpoint_file, key)
+      && key == GetCheckpointKey()
+      && utils::ReadBinary(checkpoint_file, next_update)
+      && utils::ReadBinary(checkpoint_file, model_updates)
+      && utils::ReadBinary(checkpoint_file, world)
+      && utils::ReadBinary(checkpoint_file, position_activation_order)
+      && utils::ReadBinary(checkpoint_file, subcommunity_group_repro_schedule)
+      && rnd.Deserialize(checkpoint_file)
+      && utils::ReadBinary(checkpoint_file, num_cell_rnds)
+      && num_cell_rnds == cell_interaction_buffers.cell_rnds.size();
+    for (size_t pos = 0; loaded && pos < num_cell_rnds; ++pos) {
+      loaded = cell_interaction_buffers.cell_rnds[pos].Deserialize(checkpoint_file);
+    }
+    for (size_t pos = 0; loaded && pos < num_cell_rnds; ++pos) {
+      loaded = utils::ReadBinary(checkpoint_file, cell_interaction_buffers.proposals[pos].group_repro_schedule);
+    }
+    loaded = loaded
+      && utils::ReadBinary(checkpoint_file, reps_used)
+      && recorded_communities_assembly->Deserialize(checkpoint_file)
+      && recorded_communities_adaptive->Deserialize(checkpoint_file)
+      && recorded_communities_world->Deserialize(checkpoint_file);
+    stabilization_totals.clear();
+    loaded = loaded && utils::ReadBinary(checkpoint_file, num_totals);
+    for (size_t i = 0; loaded && i < num_totals; ++i) {
+      std::string source;
+      loaded = utils::ReadBinary(checkpoint_file, source)
+        && stabilization_totals[source].Deserialize(checkpoint_file);
+    }
+    resume_output_sizes.clear();
+    loaded = loaded && utils::ReadBinary(checkpoint_file, num_output_files);
+    for (size_t i = 0; loaded && i < num_output_files; ++i) {
+      std::string output_path;
+      uint64_t output_size = 0;
+      loaded = utils::ReadBinary(checkpoint_file, output_path)
+        && utils::ReadBinary(checkpoint_file, output_size);
+      resume_output_sizes[output_path] = output_size;
+    }
+    loaded = loaded
+      && world.size() == world_size
+      && position_activation_order.size() == world_size;
+    if (!loaded) {
+      std::cout << "Unable to resume from checkpoint " << path << " (incomplete, or written with a different configuration)." << std::endl;
+      std::cout << "Exiting." << std::endl;
+      exit(-1);
+    }
+
+    resume_update = next_update;
+    resumed_stochastic_analysis = (model_updates == config->UPDATES());
+    if (resumed_stochastic_analysis) {
+      stochastic_analysis_reps_used = reps_used;
+      // Replicate stats were written out before the checkpoint
+      stochastic_analysis_reported = true;
+    } else {
+      // The assembly/adaptive models run for UPDATES updates, so their results are redone
+      // (output written before the checkpoint keeps the old results)
+      recorded_communities_assembly->Clear();
+      recorded_communities_adaptive->Clear();
+      for (const std::string source : {"assembly", "adaptive", "assembly_graph"}) {
+        stabilization_totals.erase(source);
+      }
+      std::cout << "Checkpoint was written with UPDATES=" << model_updates << "; rerunning stochastic analysis." << std::endl;
+    }
+    std::cout << "Resuming from checkpoint " << path << " at update " << resume_update << "." << std::endl;
+    return true;
+  }
+
+  // Fills the assembly/adaptive recorded community sets, either from the baseline cache
+  // (if BASELINE_CACHE_DIR is set and has results for this configuration) or by running
+  // the stochastic analysis replicates (caching the results if BASELINE_CACHE_DIR is set).
+  void RunStochasticAnalysis(int base_seed) {
+    const bool use_cache = config->BASELINE_CACHE_DIR() != "";
+    // Recording model trajectories requires actually running the models
+    const bool recording = config->RECORD_ASSEMBLY_MODEL() || config->RECORD_ADAPTIVE_MODEL();
+    const uint64_t cache_key = use_cache ? GetBaselineCacheKey(base_seed) : 0;
+    if (use_cache && !recording && LoadBaselineCache(cache_key)) return;
+
+    if (!config->ADAPTIVE_STOCHASTIC_ANALYSIS_REPS()) {
+      RunStochasticAnalysisReps(base_seed, 0, config->STOCHASTIC_ANALYSIS_REPS());
+      stochastic_analysis_reps_used = config->STOCHASTIC_ANALYSIS_REPS();
+    } else {
+      RunAdaptiveStochasticAnalysisReps(base_seed);
+    }
+    if (config->ASSEMBLY_ANALYSIS_MODE() == "exhaustive") {
+      // Weight communities as if they came from as many cells as the stochastic replicates
+      AnalyzeAssemblyStateGraph(world_size * stochastic_analysis_reps_used);
+    }
+
+    if (use_cache) SaveBaselineCache(cache_key);
+  }
+
+  // Runs batches of STOCHASTIC_ANALYSIS_REPS replicates until community proportions in the
+  // assembly/adaptive recorded community sets stop changing (no proportion moves by more
+  // than STOCHASTIC_ANALYSIS_REPS_TOLERANCE after a batch), or until
+  // MAX_STOCHASTIC_ANALYSIS_REPS replicates have run.
+  // Replicate i is the same no matter which batch it runs in, so results only depend on how
+  // many replicates end up being run.
+  void RunAdaptiveStochasticAnalysisReps(int base_seed) {
+    const size_t batch_size = std::max<size_t>(1, config->STOCHASTIC_ANALYSIS_REPS());
+    const size_t max_reps = std::max(config->MAX_STOCHASTIC_ANALYSIS_REPS(), batch_size);
+    const double tolerance = config->STOCHASTIC_ANALYSIS_REPS_TOLERANCE();
+
+    // Community counts (by community ID) before the latest batch of replicates
+    emp::vector<emp::vector<size_t>> prev_counts;
+    auto snapshot_counts = [this]() {
+      return emp::vector<emp::vector<size_t>>{
+        recorded_communities_assembly->raw.GetCommunityCounts(),
+        recorded_communities_assembly->pwip.GetCommunityCounts(),
+        recorded_communities_assembly->ranked.GetCommunityCounts(),
+        recorded_communities_assembly->ranked_threshold.GetCommunityCounts(),
+        recorded_communities_adaptive->raw.GetCommunityCounts(),
+        recorded_communities_adaptive->pwip.GetCommunityCounts(),
+        recorded_communities_adaptive->ranked.GetCommunityCounts(),
+        recorded_communities_adaptive->ranked_threshold.GetCommunityCounts()
+      };
+    };
+
+    size_t num_reps = 0;
+    while (num_reps < max_reps) {
+      const size_t next_batch_size = std::min(batch_size, max_reps - num_reps);
+      prev_counts = snapshot_counts();
+      RunStochasticAnalysisReps(base_seed, num_reps, next_batch_size);
+      num_reps += next_batch_size;
+      // Need at least two batches to measure change
+      if (num_reps == next_batch_size) continue;
+      if (GetMaxProportionChange(prev_counts, snapshot_counts()) <= tolerance) break;
+    }
+    stochastic_analysis_reps_used = num_reps;
+  }
+
+  // Largest change in any community's proportion between two snapshots of the same recorded
+  // community sets' counts (community IDs are stable as communities are added).
+  static double GetMaxProportionChange(
+    const emp::vector<emp::vector<size_t>>& prev_counts,
+    const emp::vector<emp::vector<size_t>>& cur_counts
+  ) {
+    emp_assert(prev_counts.size() == cur_counts.size());
+    double max_change = 0.0;
+    for (size_t set_i = 0; set_i < cur_counts.size(); ++set_i) {
+      const auto& prev = prev_counts[set_i];
+      const auto& cur = cur_counts[set_i];
+      emp_assert(prev.size() <= cur.size());
+      const double prev_total = (double)emp::Sum(prev);
+      const double cur_total = (double)emp::Sum(cur);
+      if (cur_total == 0) continue;
+      for (size_t id = 0; id < cur.size(); ++id) {
+        const double prev_prop = (id < prev.size() && prev_total > 0) ? (double)prev[id] / prev_total : 0.0;
+        const double cur_prop = (double)cur[id] / cur_total;
+        max_change = std::max(max_change, std::abs(cur_prop - prev_prop));
+      }
+    }
+    return max_change;
+  }
+
+  // Fills the assembly recorded community sets from the assembly-state graph (instead of
+  // running assembly model replicates): the distribution over stable communities after
+  // UPDATES seeding steps, starting from the empty community (see AssemblyStateGraph for
+  // how this approximates the assembly model).
+  // Communities are recorded as if found in their share of num_cells cells (apportioned by
+  // largest remainder, so recorded counts add up to num_cells). Reachable communities too
+  // rare to get a single cell are reported, but not recorded.
+  void AnalyzeAssemblyStateGraph(size_t num_cells) {
+    AssemblyStateGraph graph;
+    emp::vector<double> scratch;
+    const size_t max_updates = config->CELL_STABILIZATION_UPDATES();
+    assembly_graph_stats.Clear();
+    graph.Build(
+      N_TYPES,
+      config->SEEDING_PROB(),
+      MAX_POP,
+      [this, &scratch, max_updates](AssemblyStateGraph::cell_t& cell) {
+        const size_t updates = StabilizeCell(cell, scratch, max_updates);
+        assembly_graph_stats.RecordCell(assembly_graph_stats.num_cells, updates, updates < max_updates);
+      }
+    );
+    const emp::vector<double> community_probs = graph.GetCommunityDistribution(config->UPDATES());
+
+    // Largest remainder apportionment of num_cells cells among communities
+    const size_t num_communities = graph.GetNumCommunities();
+    emp::vector<size_t> community_counts(num_communities, 0);
+    emp::vector<size_t> by_remainder(num_communities);
+    std::iota(by_remainder.begin(), by_remainder.end(), 0);
+    size_t assigned = 0;
+    for (size_t community_id = 0; community_id < num_communities; ++community_id) {
+      community_counts[community_id] = (size_t)std::floor(community_probs[community_id] * (double)num_cells);
+      assigned += community_counts[community_id];
+    }
+    auto remainder = [&](size_t community_id) {
+      return community_probs[community_id] * (double)num_cells - (double)community_counts[community_id];
+    };
+    std::stable_sort(
+      by_remainder.begin(),
+      by_remainder.end(),
+      [&](size_t a, size_t b) { return remainder(a) > remainder(b); }
+    );
+    for (size_t i = 0; assigned < num_cells && i < by_remainder.size(); ++i) {
+      ++community_counts[by_remainder[i]];
+      ++assigned;
+    }
+
+    emp::vector<double> stable_cell(N_TYPES, 0.0);
+    CellCommunitySummaries summaries;
+    size_t num_unrecorded = 0;
+    double unrecorded_prob = 0.0;
+    for (size_t community_id = 0; community_id < num_communities; ++community_id) {
+      if (community_counts[community_id] == 0) {
+        num_unrecorded += community_probs[community_id] > 0;
+        unrecorded_prob += community_probs[community_id];
+        continue;
+      }
+      // Graph communities are already stable
+      stable_cell = graph.GetCommunity(community_id);
+      SummarizeStableCell(stable_cell, summaries);
+      recorded_communities_assembly->Add(summaries, community_counts[community_id]);
+    }
+    if (num_unrecorded > 0) {
+      std::cout << "Exhaustive assembly analysis: " << num_unrecorded
+        << " reachable communities (total probability " << unrecorded_prob
+        << ") are too rare to record in " << num_cells << " cells." << std::endl;
+    }
+  }
+
+  // Hash of every input that assembly/adaptive model results depend on.
+  // NOTE: bump BASELINE_CACHE_VERSION whenever model or summary code changes in a way that
+  //       changes results (otherwise, stale cached results will be loaded).
+  uint64_t GetBaselineCacheKey(int base_seed) const {
+    constexpr uint32_t BASELINE_CACHE_VERSION = 9;
+    utils::Hasher hasher;
+    hasher.Add(BASELINE_CACHE_VERSION);
+    hasher.Add((uint64_t)N_TYPES);
+    hasher.Add(MAX_POP);
+    hasher.Add(interactions.GetInteractions());
+    hasher.Add((uint64_t)world_size);
+    for (size_t pos = 0; pos < world_size; ++pos) {
+      hasher.Add(group_repro_spatial_structure.GetNeighbors(pos));
+    }
+    hasher.Add((uint64_t)config->UPDATES());
+    hasher.Add((double)config->SEEDING_PROB());
+    hasher.Add((double)config->PROB_CLEAR());
+    hasher.Add((double)config->REPRO_DILUTION());
+    hasher.Add((uint64_t)config->CELL_STABILIZATION_UPDATES());
+    hasher.Add((double)config->CELL_STABILIZATION_EPSILON());
+    hasher.Add((double)config->THRESHOLD_VALUE());
+    hasher.Add((uint64_t)config->STOCHASTIC_ANALYSIS_REPS());
+    hasher.Add(config->ADAPTIVE_STOCHASTIC_ANALYSIS_REPS());
+    if (config->ADAPTIVE_STOCHASTIC_ANALYSIS_REPS()) {
+      hasher.Add((uint64_t)config->MAX_STOCHASTIC_ANALYSIS_REPS());
+      hasher.Add((double)config->STOCHASTIC_ANALYSIS_REPS_TOLERANCE());
+    }
+    hasher.Add(base_seed);
+    hasher.Add(config->ASSEMBLY_ANALYSIS_MODE());
+    hasher.Add(config->PARALLEL_GROUP_REPRO());
+    hasher.Add((uint64_t)config->RECORDED_COMMUNITY_CAPACITY());
+    hasher.Add((uint64_t)config->RECORDED_COMMUNITY_SKETCH_WIDTH());
+    return hasher.GetHash();
+  }
+
+  std::string GetBaselineCachePath(uint64_t cache_key) const {
+    std::stringstream path;
+    path << config->BASELINE_CACHE_DIR() << "/baseline_";
+    path << std::hex << std::setw(16) << std::setfill('0') << cache_key << ".bin";
+    return path.str();
+  }
+
+  // Loads assembly/adaptive recorded community sets from the baseline cache.
+  // Returns false (leaving the sets empty) if there are no valid cached results for cache_key.
+  bool LoadBaselineCache(uint64_t cache_key) {
+    const std::string path = GetBaselineCachePath(cache_key);
+    std::ifstream cache_file(path, std::ios::binary);
+    if (!cache_file) return false;
+    std::string magic;
+    uint64_t file_key = 0;
+    uint64_t reps_used = 0;
+    const bool loaded = utils::ReadBinary(cache_file, magic)
+      && magic == "a-eco-baseline"
+      && utils::ReadBinary(cache_file, file_key)
+      && file_key == cache_key
+      && utils::ReadBinary(cache_file, reps_used)
+      && recorded_communities_assembly->Deserialize(cache_file)
+      && recorded_communities_adaptive->Deserialize(cache_file);
+    if (!loaded) {
+      std::cout << "Ignoring invalid baseline cache file: " << path << std::endl;
+      recorded_communities_assembly->Clear();
+      recorded_communities_adaptive->Clear();
+      return false;
+    }
+    stochastic_analysis_reps_used = reps_used;
+    std::cout << "Loaded assembly/adaptive results from baseline cache: " << path << std::endl;
+    return true;
+  }
+
+  // Saves assembly/adaptive recorded community sets to the baseline cache.
+  // Written to a temporary file first, so concurrent runs never see a partial file.
+  void SaveBaselineCache(uint64_t cache_key) const {
+    mkdir(config->BASELINE_CACHE_DIR().c_str(), ACCESSPERMS);
+    const std::string path = GetBaselineCachePath(cache_key);
+    const std::string tmp_path = path + ".tmp" + emp::to_string(getpid());
+    {
+      std::ofstream cache_file(tmp_path, std::ios::binary);
+      utils::WriteBinary(cache_file, std::string("a-eco-baseline"));
+      utils::WriteBinary(cache_file, cache_key);
+      utils::WriteBinary(cache_file, (uint64_t)stochastic_analysis_reps_used);
+      recorded_communities_assembly->Serialize(cache_file);
+      recorded_communities_adaptive->Serialize(cache_file);
+      if (!cache_file) {
+        std::cout << "Failed to write baseline cache file: " << tmp_path << std::endl;
+        std::remove(tmp_path.c_str());
+        return;
+      }
+    }
+    std::rename(tmp_path.c_str(), path.c_str());
+  }
+
+  // Runs replicates [first_rep, first_rep + num_reps) of the assembly and adaptive models (on
+  // up to NUM_THREADS threads), adding their summarized communities to the recorded community sets.
+  // Each replicate has its own random number stream (derived from base_seed and the
+  // replicate number) and its own recorded community sets, which are merged in replicate
+  // order, so results do not depend on the number of threads.
+  // Only touches the assembly/adaptive recorded community sets, model recording files, and
+  // per-replicate stats, so it is safe to run alongside the main world's updates.
+  void RunStochasticAnalysisReps(int base_seed, size_t first_rep, size_t num_reps) {
+    emp::vector<RecordedCommunitySets> rep_assembly_communities;
+    emp::vector<RecordedCommunitySets> rep_adaptive_communities;
+    for (size_t i = 0; i < num_reps; ++i) {
+      rep_assembly_communities.emplace_back(recorded_comm_key_fun, recorded_comm_ranks_key_fun);
+      rep_adaptive_communities.emplace_back(recorded_comm_key_fun, recorded_comm_ranks_key_fun);
+    }
+    rep_assembly_stats.resize(first_rep + num_reps);
+    rep_adaptive_stats.resize(first_rep + num_reps);
+
+    // Replicates are spread across threads; any threads left over go to cells within each replicate
+    const size_t num_threads = utils::GetNumThreads(config->NUM_THREADS());
+    const size_t cell_threads = std::max<size_t>(1, num_threads / std::max<size_t>(1, num_reps));
+
+    emp::vector<emp::Random> rep_rnds;
+    rep_rnds.reserve(num_reps);
+    for (size_t i = 0; i < num_reps; ++i) {
+      rep_rnds.emplace_back(utils::GetStreamSeed(base_seed, first_rep + i));
+    }
+
+    const bool run_assembly = config->ASSEMBLY_ANALYSIS_MODE() == "stochastic";
+
+    utils::ParallelFor(0, num_reps, num_threads, [&](size_t i) {
+      const size_t rep = first_rep + i;
+      emp::Random& rep_rnd = rep_rnds[i];
+      emp::vector<size_t> rep_group_repro_schedule(subcommunity_group_repro_schedule);
+
+      // Run assembly model (unless assembly results come from the assembly-state graph)
+      world_t assemblyModel;
+      if (run_assembly) {
+        assemblyModel = AssemblyModel(
+          config->UPDATES(),
+          config->SEEDING_PROB(),
+          rep,
+          rep_rnd,
+          cell_threads
+        );
+      } else {
+        // Keep the adaptive model's random number stream the same in every mode
+        DrawCellSeedBase(rep_rnd);
+      }
+
+      // Run adaptive model
+      world_t adaptiveModel = AdaptiveModel(
+        config->UPDATES(),
+        config->PROB_CLEAR(),
+        config->SEEDING_PROB(),
+        rep,
+        rep_rnd,
+        rep_group_repro_schedule,
+        cell_threads
+      );
+
+      // Summarize (stabilized, ranked) recorded communities
+      AnalyzeCommunities(assemblyModel, rep_assembly_communities[i], rep_assembly_stats[rep], cell_threads);
+      AnalyzeCommunities(adaptiveModel, rep_adaptive_communities[i], rep_adaptive_stats[rep], cell_threads);
+    });
+
+    for (size_t i = 0; i < num_reps; ++i) {
+      recorded_communities_assembly->Merge(rep_assembly_communities[i]);
+      recorded_communities_adaptive->Merge(rep_adaptive_communities[i]);
+    }
+  }
+
+  // Is the stochastic analysis still running in the background?
+  bool StochasticAnalysisRunning() const {
+    return stochastic_analysis_task.valid()
+      && stochastic_analysis_task.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+  }
+
+  // Waits for the stochastic analysis to finish (if running in the background), then writes
+  // out anything that was waiting on its results.
+  void FinishStochasticAnalysis() {
+    if (stochastic_analysis_task.valid()) stochastic_analysis_task.get();
+
+    if (!stochastic_analysis_reported) {
+      for (size_t rep = 0; rep < rep_assembly_stats.size(); ++rep) {
+        // No assembly stats when assembly results come from the assembly-state graph
+        if (rep_assembly_stats[rep].num_cells > 0) {
+          RecordStabilization("assembly", rep, config->UPDATES(), rep_assembly_stats[rep]);
+        }
+        RecordStabilization("adaptive", rep, config->UPDATES(), rep_adaptive_stats[rep]);
+      }
+      if (assembly_graph_stats.num_cells > 0) {
+        RecordStabilization("assembly_graph", 0, 0, assembly_graph_stats);
+      }
+      rep_assembly_stats.clear();
+      rep_adaptive_stats.clear();
+      // Update run configuration snapshot with the number of replicates actually run
+      SnapshotConfig();
+      stochastic_analysis_reported = true;
+    }
+
+    for (const auto& pending : pending_world_communities_pwip) {
+      world_community_summary_pwip_file->Update(
+        pending.first,
+        pending.second,
+        recorded_communities_assembly->pwip,
+        recorded_communities_adaptive->pwip
+      );
+    }
+    pending_world_communities_pwip.clear();
+  }
+
   // Handle an individual time step
   // ud = which time step we're on
   void Update() {
@@ -614,30 +1499,43 @@ public:
 
     // Handle everything that allows biomass to move from
     // one cell to another. Do so for each cell
-    for (size_t i = 0; i < world.size(); ++i) {
-
-      const size_t pos = position_activation_order[i];
-      // Actually call function that handles between-cell
-      // movement
-      // (1) Do group reproduction?
-      if (config->GROUP_REPRO()) {
-        DoGroupRepro(pos, world, next_world);
-      }
-      // (2) Do cell clearing
-      DoClearing(pos, world, next_world, config->PROB_CLEAR());
-      // (3) Do diffusion
-      DoDiffusion(pos, world, next_world, config->DIFFUSION());
-      // (4) Do seeding
-      DoSeeding(pos, world, next_world, config->SEEDING_PROB());
+    if (config->PARALLEL_GROUP_REPRO()) {
+      DoCellInteractions(
+        world,
+        next_world,
+        position_activation_order,
+        cell_interaction_buffers,
+        config->GROUP_REPRO(),
+        config->PROB_CLEAR(),
+        config->DIFFUSION(),
+        config->SEEDING_PROB(),
+        utils::GetNumThreads(config->NUM_THREADS())
+      );
+    } else {
+      for (size_t i = 0; i < world.size(); ++i) {
+
+        const size_t pos = position_activation_order[i];
+        // Actually call function that handles between-cell
+        // movement
+        // (1) Do group reproduction?
+        if (config->GROUP_REPRO()) {
+          DoGroupRepro(pos, world, next_world);
+        }
+        // (2) Do cell clearing
+        DoClearing(pos, world, next_world, config->PROB_CLEAR());
+        // (3) Do diffusion
+        DoDiffusion(pos, world, next_world, config->DIFFUSION());
+        // (4) Do seeding
+        DoSeeding(pos, world, next_world, config->SEEDING_PROB());
 
+      }
     }
 
     // Give data_file the opportunity to write to the file
-    // TODO - can we eliminate worldState variable?
-    // E.g., if we move after swap, world should be up-to-date
-    worldState = next_world;
     if (config->RECORD_A_ECO_DATA()) {
+      recorded_world = &next_world;
       data_file->Update(world_update);
+      recorded_world = nullptr;
     }
 
     // We're done calculating the type counts for the next
@@ -654,41 +1552,104 @@ public:
         /*output_snapshots = */ is_final_update
       );
     }
-
-    // Clean-up data trackers
-    worldState.clear();
   }
 
   // Handles population growth of each type within a cell
   void DoGrowth(size_t pos, const world_t& curr_world, world_t& next_world) {
-    //For each species i
+    DoCellGrowth(curr_world[pos], next_world[pos]);
+  }
+
+  // Handles population growth of each type within a single cell's counts
+  // A species with a count of 0 stays at 0 and contributes nothing to the growth
+  // of any other species, so only the present x present block of the interaction
+  // matrix needs to be evaluated. The list of present species is gathered from the
+  // cell itself, so species introduced by seeding, diffusion, or group repro are
+  // always picked up.
+  // Returns the squared magnitude of the change in the cell's composition (used by
+  // StabilizeCell to check for convergence without another pass over the cell).
+  double DoCellGrowth(const emp::vector<double>& cur_cell, emp::vector<double>& next_cell) {
+    // Scratch space for present species IDs (per-thread so growth can run concurrently)
+    thread_local emp::vector<size_t> present_ids;
+    present_ids.clear();
     for (size_t i = 0; i < N_TYPES; i++) {
+      if (cur_cell[i] != 0) {
+        present_ids.emplace_back(i);
+      } else {
+        next_cell[i] = 0;
+      }
+    }
+
+    double delta_sq = 0.0;
+    //For each present species i
+    for (size_t i : present_ids) {
+      const auto& effects_on_i = interactions[i];
       double modifier = 0;
-      for (size_t j = 0; j < N_TYPES; j++) {
+      for (size_t j : present_ids) {
         // Sum up growth rate modifier for type i
         // NOTE (@AML): does directionality [i][j] [j][i] matter here? (i.e., are interaction graphs directed or undirected?)
         // Updated species I, species I changing based on interaction[i][j]
         // Effect species j has on species i is inter[i][j]
-        modifier += interactions[i][j] * curr_world[pos][j];
+        modifier += effects_on_i[j] * cur_cell[j];
       }
-      const double cur_count = curr_world[pos][i];
+      const double cur_count = cur_cell[i];
       // Logistic Growth
       const double new_pop = modifier * cur_count * (1 - (cur_count/MAX_POP)); // * ((double)(MAX_POP - pos[i])/MAX_POP));
       // Population size cannot be negative
-      next_world[pos][i] = std::max(cur_count + new_pop, 0.0);
+      next_cell[i] = std::max(cur_count + new_pop, 0.0);
       // Population size capped at MAX_POP
-      next_world[pos][i] = std::min(next_world[pos][i], MAX_POP);
-      emp_assert(next_world[pos][i] <= MAX_POP);
+      next_cell[i] = std::min(next_cell[i], MAX_POP);
+      emp_assert(next_cell[i] <= MAX_POP);
+      const double change = next_cell[i] - cur_count;
+      delta_sq += change * change;
     }
+    return delta_sq;
   }
 
   // The probability of group reproduction is proportional to
   // the biomass of the community
   void DoGroupRepro(size_t pos, const world_t& w, world_t& next_w) {
+    DoGroupRepro(pos, w, next_w, rnd, subcommunity_group_repro_schedule);
+  }
+
+  // Group reproduction using the given random number generator and sub-community schedule
+  void DoGroupRepro(
+    size_t pos,
+    const world_t& w,
+    world_t& next_w,
+    emp::Random& random,
+    emp::vector<size_t>& group_repro_schedule
+  ) {
+    const double dilution = config->REPRO_DILUTION();
+    ForEachGroupRepro(
+      pos,
+      w,
+      random,
+      group_repro_schedule,
+      [&](size_t new_pos) {
+        for (size_t i = 0; i < N_TYPES; i++) {
+          // Add a portion (configured by REPRO_DILUTION) of the quantity of the type
+          // in the focal cell to the cell we're replicating into
+          // NOTE: An important decision here is whether to clear the cell first.
+          // We have chosen to, but can revisit that choice
+          next_w[new_pos][i] = w[pos][i] * dilution;
+        }
+      }
+    );
+  }
+
+  // Decides which neighboring positions the cell at pos group-reproduces into, calling
+  // repro_fun(new_pos) for each (in order). Does not modify any world.
+  template<typename REPRO_FUN>
+  void ForEachGroupRepro(
+    size_t pos,
+    const world_t& w,
+    emp::Random& random,
+    emp::vector<size_t>& group_repro_schedule,
+    REPRO_FUN&& repro_fun
+  ) {
     // Get these values once so they can be reused
     const int max_pop = config->MAX_POP();
     const size_t types = config->N_TYPES();
-    const double dilution = config->REPRO_DILUTION();
     emp_assert(max_pop * types > 0);
 
     // Get neighbors
@@ -700,9 +1661,9 @@ public:
     // Need to do GR in a random order, so the last sub-community does not have more repro power
     // emp::Shuffle(rnd, subCommunities);
     // for (const auto& community : subCommunities) {
-    emp::Shuffle(rnd, subcommunity_group_repro_schedule);
-    for (size_t schedule_i = 0; schedule_i < subcommunity_group_repro_schedule.size(); ++schedule_i) {
-      const size_t community_id = subcommunity_group_repro_schedule[schedule_i];
+    emp::Shuffle(random, group_repro_schedule);
+    for (size_t schedule_i = 0; schedule_i < group_repro_schedule.size(); ++schedule_i) {
+      const size_t community_id = group_repro_schedule[schedule_i];
       const auto& community = community_structure.GetSubCommunity(community_id);
       // Compute population size of this community
       double pop = 0;
@@ -712,31 +1673,27 @@ public:
       const double ratio = pop / (max_pop * types);
 
       // If group repro
-      if (rnd.P(ratio)) {
+      if (random.P(ratio)) {
 
         // Get a random neighboring cell to reproduce into
         const auto rnd_neighbor = group_repro_spatial_structure.GetRandomNeighbor(
-          rnd,
+          random,
           pos
         ); // Returned if not neighbors, this should always be valid.
         emp_assert(rnd_neighbor);
-        const size_t new_pos = rnd_neighbor.value();
-
-        for (size_t i = 0; i < N_TYPES; i++) {
-          // Add a portion (configured by REPRO_DILUTION) of the quantity of the type
-          // in the focal cell to the cell we're replicating into
-          // NOTE: An important decision here is whether to clear the cell first.
-          // We have chosen to, but can revisit that choice
-          next_w[new_pos][i] = w[pos][i] * dilution;
-        }
+        repro_fun(rnd_neighbor.value());
       }
 
     }
   }
 
   void DoClearing(size_t pos, const world_t& curr_world, world_t& next_world, double prob_clear) {
+    DoClearing(pos, curr_world, next_world, prob_clear, rnd);
+  }
+
+  void DoClearing(size_t pos, const world_t& curr_world, world_t& next_world, double prob_clear, emp::Random& random) {
     // Each cell has a chance of being cleared on every time step
-    if (rnd.P(prob_clear)) {
+    if (random.P(prob_clear)) {
       for (size_t i = 0; i < N_TYPES; i++) {
         next_world[pos][i] = 0;
       }
@@ -776,169 +1733,352 @@ public:
   }
 
   void DoSeeding(size_t pos, const world_t& curr_world, world_t& next_world, double seed_prob) {
+    DoSeeding(pos, curr_world, next_world, seed_prob, rnd);
+  }
+
+  void DoSeeding(size_t pos, const world_t& curr_world, world_t& next_world, double seed_prob, emp::Random& random) {
+    DoCellSeeding(next_world[pos], seed_prob, random);
+  }
+
+  void DoCellSeeding(emp::vector<double>& next_cell, double seed_prob, emp::Random& random) {
     // Seed in  (every species has an individual prob to seed in)
     for (size_t i = 0; i < N_TYPES; i++){
-      if (rnd.P(seed_prob)) {
-        next_world[pos][i]++;
-        next_world[pos][i] = std::min(next_world[pos][i], MAX_POP);
+      if (random.P(seed_prob)) {
+        next_cell[i]++;
+        next_cell[i] = std::min(next_cell[i], MAX_POP);
       }
     }
   }
 
-  // This function should be called to create a stable copy of the world
-  world_t GenStabilizedWorld(const world_t& custom_world, size_t max_updates=10000) {
-
-    // Track current and next state of world
-    world_t stable_world(
-      world_size,
-      emp::vector<double>(N_TYPES, 0.0)
-    );
-    world_t next_stable_world(stable_world);
-
-    // Copy current world into stable world
-    std::copy(
-      custom_world.begin(),
-      custom_world.end(),
-      stable_world.begin()
-    );
-    emp_assert(custom_world == stable_world);
-
-    for (size_t i = 0; i < max_updates; i++) {
+  // Gives each of the world's cells its own random number stream (and group repro schedule)
+  // for two-phase between-cell updates
+  void SetupCellInteractionBuffers(CellInteractionBuffers& buffers, int cell_seed_base) {
+    buffers.cell_rnds.clear();
+    buffers.cell_rnds.reserve(world_size);
+    for (size_t pos = 0; pos < world_size; ++pos) {
+      buffers.cell_rnds.emplace_back(utils::GetStreamSeed(cell_seed_base, pos));
+    }
+    buffers.proposals.clear();
+    buffers.proposals.resize(world_size);
+    for (CellProposal& proposal : buffers.proposals) {
+      proposal.group_repro_schedule = subcommunity_group_repro_schedule;
+    }
+    buffers.cell_ops.clear();
+    buffers.cell_ops.resize(world_size);
+  }
 
-      // Handle population growth for each cell
-      for (size_t pos = 0; pos < stable_world.size(); pos++) {
-        DoGrowth(pos, stable_world, next_stable_world);
+  // Two-phase version of the between-cell updates (group repro, clearing, diffusion, seeding)
+  // that follow growth. Gives the same result as handling each cell in turn (in activation
+  // order), except that every cell draws from its own random number stream. Results do not
+  // depend on the number of threads used.
+  // (1) Propose: every cell decides (in parallel) where it group-reproduces to, whether it
+  //     is cleared, and which types seed into it. These decisions only depend on w.
+  // (2) Resolve: operations are collected for each cell of next_w, in activation order.
+  //     A group repro copy overwrites its target, so only operations from the latest copy
+  //     into a cell (by activation order) onward can affect it.
+  // (3) Commit: every cell of next_w applies its remaining operations (in parallel).
+  void DoCellInteractions(
+    const world_t& w,
+    world_t& next_w,
+    const emp::vector<size_t>& activation_order,
+    CellInteractionBuffers& buffers,
+    bool group_repro,
+    double prob_clear,
+    double diffusion,
+    double seed_prob,
+    size_t num_threads
+  ) {
+    emp_assert(buffers.cell_rnds.size() == w.size());
+    using op_t = CellOp::op_t;
+
+    // (1) Propose
+    utils::ParallelFor(0, w.size(), num_threads, [&](size_t pos) {
+      emp::Random& random = buffers.cell_rnds[pos];
+      CellProposal& proposal = buffers.proposals[pos];
+      proposal.repro_targets.clear();
+      if (group_repro) {
+        ForEachGroupRepro(
+          pos,
+          w,
+          random,
+          proposal.group_repro_schedule,
+          [&proposal](size_t new_pos) { proposal.repro_targets.emplace_back(new_pos); }
+        );
       }
-
-      // We can stop iterating early if the world has already stabilized
-      double delta = 0;
-      const double epsilon = config->CELL_STABILIZATION_EPSILON();
-      for (size_t j = 0; j < stable_world.size(); j++) {
-        delta += emp::EuclideanDistance(stable_world[j], next_stable_world[j]);
+      proposal.clear = random.P(prob_clear);
+      proposal.seeded_types.clear();
+      for (size_t i = 0; i < N_TYPES; ++i) {
+        if (random.P(seed_prob)) proposal.seeded_types.emplace_back(i);
       }
-      // If the change from one world to the next is very small, return early
-      if (delta < epsilon) {
-        for (size_t pos = 0; pos < stable_world.size(); pos++) {
-          for (size_t s = 0; s < stable_world[pos].size(); s++) {
-            stable_world[pos][s] = round(stable_world[pos][s]);
-          }
-        }
-        return stable_world;
+    });
+
+    // (2) Resolve
+    for (auto& ops : buffers.cell_ops) ops.clear();
+    for (size_t pos : activation_order) {
+      const CellProposal& proposal = buffers.proposals[pos];
+      for (size_t new_pos : proposal.repro_targets) {
+        buffers.cell_ops[new_pos].push_back({op_t::REPRO, pos});
       }
-      std::swap(stable_world, next_stable_world);
-    }
-    std::cout << "\n Max number of stable updates reached" << std::endl;
-    for (size_t pos = 0; pos < stable_world.size(); pos++) {
-      for (size_t s = 0; s < stable_world[pos].size(); s++) {
-        stable_world[pos][s] = round(stable_world[pos][s]);
+      if (proposal.clear) buffers.cell_ops[pos].push_back({op_t::CLEAR, pos});
+      const auto& neighbors = diffusion_spatial_structure.GetNeighbors(pos);
+      if (diffusion != 0 && neighbors.size() > 0) {
+        for (size_t neighbor : neighbors) {
+          buffers.cell_ops[neighbor].push_back({op_t::DIFFUSE_IN, pos});
+        }
+        buffers.cell_ops[pos].push_back({op_t::DIFFUSE_OUT, pos});
       }
+      if (proposal.seeded_types.size() > 0) buffers.cell_ops[pos].push_back({op_t::SEED, pos});
     }
-    return stable_world;
-  }
 
-  // This function should be called to create a ranked copy of the world
-  world_t GenRankedWorld(const world_t& custom_world, bool threshold) {
-    world_t eval_world;
-    // To handle cases where sparse matricies disrput rankings with many 
-    // low magnitude species, we can round down species less than a threshold value
-    if(threshold){
-      world_t threshold_world(
-      world_size,
-      emp::vector<double>(N_TYPES, 0.0)
-      );
-      for (size_t pos = 0; pos < custom_world.size(); pos++) {
-          for (size_t s = 0; s < custom_world[pos].size(); s++) {
-            if(custom_world[pos][s] < config->THRESHOLD_VALUE()){
-              threshold_world[pos][s] = 0;
-            }
-            else{
-              threshold_world[pos][s] = custom_world[pos][s];
+    // (3) Commit
+    const double dilution = config->REPRO_DILUTION();
+    utils::ParallelFor(0, w.size(), num_threads, [&](size_t pos) {
+      const auto& ops = buffers.cell_ops[pos];
+      size_t first_op = 0;
+      for (size_t op_i = ops.size(); op_i > 0; --op_i) {
+        if (ops[op_i - 1].type == op_t::REPRO) {
+          first_op = op_i - 1;
+          break;
+        }
+      }
+      emp::vector<double>& next_cell = next_w[pos];
+      for (size_t op_i = first_op; op_i < ops.size(); ++op_i) {
+        const size_t src = ops[op_i].src;
+        switch (ops[op_i].type) {
+          case op_t::REPRO:
+            for (size_t i = 0; i < N_TYPES; ++i) next_cell[i] = w[src][i] * dilution;
+            break;
+          case op_t::CLEAR:
+            for (size_t i = 0; i < N_TYPES; ++i) next_cell[i] = 0;
+            break;
+          case op_t::DIFFUSE_IN: {
+            // Same arithmetic as DoDiffusion
+            const size_t num_neighbors = diffusion_spatial_structure.GetNeighbors(src).size();
+            for (size_t i = 0; i < N_TYPES; ++i) {
+              const double avail = w[src][i] * diffusion;
+              next_cell[i] += avail / num_neighbors;
+              next_cell[i] = std::min(next_cell[i], MAX_POP);
+              next_cell[i] = std::max(next_cell[i], 0.0);
             }
+            break;
           }
+          case op_t::DIFFUSE_OUT:
+            for (size_t i = 0; i < N_TYPES; ++i) {
+              next_cell[i] -= w[pos][i] * diffusion;
+              next_cell[i] = std::max(next_cell[i], 0.0);
+            }
+            break;
+          case op_t::SEED:
+            for (size_t i : buffers.proposals[pos].seeded_types) {
+              next_cell[i]++;
+              next_cell[i] = std::min(next_cell[i], MAX_POP);
+            }
+            break;
         }
-      eval_world = threshold_world;
+      }
+    });
+  }
+
+  // Runs growth on a single cell until its composition stops changing (the cell's
+  // Euclidean change over one update is below CELL_STABILIZATION_EPSILON), or until
+  // max_updates is reached. Every cell stops on its own; this differs from the original
+  // world-wide rule (stop once the sum of all cells' changes is below epsilon), which
+  // kept every cell running until the slowest one converged.
+  // The cell is stabilized in place (final counts are rounded), and scratch is used as
+  // the next-state buffer.
+  // Returns the number of growth updates the cell needed to converge (max_updates if
+  // it never converged).
+  size_t StabilizeCell(
+    emp::vector<double>& cell,
+    emp::vector<double>& scratch,
+    size_t max_updates=10000
+  ) {
+    // Convergence is checked on squared distances to avoid a sqrt per step
+    const double epsilon = config->CELL_STABILIZATION_EPSILON();
+    const double epsilon_sq = epsilon * epsilon;
+    scratch.resize(cell.size());
+
+    size_t updates = 0;
+    for (; updates < max_updates; updates++) {
+      const double delta_sq = DoCellGrowth(cell, scratch);
+      // If the change from one step to the next is very small, stop early
+      if (delta_sq < epsilon_sq) break;
+      std::swap(cell, scratch);
     }
-    else{
-      eval_world = custom_world;
+
+    for (double& count : cell) {
+      count = round(count);
     }
+    return updates;
+  }
 
-    world_t ranked_world(
-      world_size,
-      emp::vector<double>(N_TYPES, 0.0)
+  // Writes the dominance ranking of each species in the given cell into ranked
+  // (rank 1 is most abundant; tied species share a rank). ranked_threshold gets the
+  // same ranking, but with species below THRESHOLD_VALUE treated as absent.
+  // Both rankings are derived from a single sort of the cell.
+  void RankCell(
+    const emp::vector<double>& cell,
+    emp::vector<rank_t>& ranked,
+    emp::vector<rank_t>& ranked_threshold
+  ) {
+    emp_assert(cell.size() <= std::numeric_limits<rank_t>::max());
+    // Scratch space (per-thread so ranking can run concurrently)
+    thread_local emp::vector<rank_t> sortedIndices;
+
+    const size_t num_species = cell.size();
+    sortedIndices.resize(num_species);
+    std::iota(sortedIndices.begin(), sortedIndices.end(), 0);
+    std::sort(
+      sortedIndices.begin(),
+      sortedIndices.end(),
+      [&cell](rank_t x, rank_t y) { return cell[x] > cell[y]; }
     );
 
-    for (size_t i = 0; i < eval_world.size(); i++) {
-
-      auto comparator = [i, &eval_world](int x, int y){
-        return eval_world[i][x] > eval_world[i][y];
-      };
-
-      emp::vector<int> sortedIndices(eval_world[i].size());
-      std::iota(sortedIndices.begin(), sortedIndices.end(), 0);
-      std::sort(sortedIndices.begin(), sortedIndices.end(), comparator);
+    ranked.resize(num_species);
+    ranked_threshold.resize(num_species);
+    // To handle cases where sparse matricies disrput rankings with many
+    // low magnitude species, we can round down species less than a threshold value.
+    // Rounded-down species sort to the back, where they all tie at 0 (as long as the
+    // threshold is positive, nothing at or above the threshold can tie with them).
+    const double threshold_value = config->THRESHOLD_VALUE();
+    rank_t curr_rank = 1;
+    rank_t curr_threshold_rank = 1;
+    bool in_threshold_tail = false;
+    for (size_t j = 0; j < num_species; j++) {
+      const double count = cell[sortedIndices[j]];
+      if (j > 0 && count != cell[sortedIndices[j - 1]]) {
+        curr_rank = j + 1;
+        if (!in_threshold_tail) curr_threshold_rank = j + 1;
+      }
+      if (!in_threshold_tail && count < threshold_value) {
+        in_threshold_tail = true;
+        curr_threshold_rank = j + 1;
+      }
+      ranked[sortedIndices[j]] = curr_rank;
+      ranked_threshold[sortedIndices[j]] = curr_threshold_rank;
+    }
 
-      int curr_rank = 1;
-      for(size_t j = 0; j < eval_world[i].size(); j++){
-        //ranked[sortedIndices[j]] = j + 1;
-        if (j > 0 && eval_world[i][sortedIndices[j]] != eval_world[i][sortedIndices[j - 1]]) {
-            curr_rank = j + 1;
-          }
-        ranked_world[i][sortedIndices[j]] = curr_rank;
+    // With a non-positive threshold, rounded-down (negative) counts are not guaranteed
+    // to sort behind everything else, so fall back to ranking the rounded-down cell.
+    if (threshold_value <= 0 && in_threshold_tail) {
+      thread_local emp::vector<double> eval_cell;
+      thread_local emp::vector<rank_t> unused_ranks;
+      eval_cell.resize(num_species);
+      for (size_t s = 0; s < num_species; s++) {
+        eval_cell[s] = (cell[s] < threshold_value) ? 0 : cell[s];
       }
+      RankCell(eval_cell, ranked_threshold, unused_ranks);
     }
-    return ranked_world;
   }
 
   world_t AssemblyModel(
     int num_updates,
-    double prob_clear,
     double seeding_prob
   ) {
-    // Track current and next stochastic model worlds.
+    return AssemblyModel(num_updates, seeding_prob, stochastic_rep, rnd);
+  }
+
+  // Runs the assembly model for the given replicate using the given random number generator.
+  // The assembly model has no spatial structure, clearing, or group repro, so every cell
+  // evolves independently. Each cell gets its own random number stream (seeded from
+  // random), which lets cells run their whole trajectories one at a time (on up to
+  // num_threads threads) without the result depending on execution order.
+  world_t AssemblyModel(
+    int num_updates,
+    double seeding_prob,
+    size_t rep,
+    emp::Random& random,
+    size_t num_threads=1
+  ) {
+    const int cell_seed_base = DrawCellSeedBase(random);
     world_t model_world(
       world_size,
       emp::vector<double>(N_TYPES, 0.0)
     );
-    world_t next_model_world(model_world);
 
-    for (int i = 0; i < num_updates; i++) {
-      // handle in cell growth
-      for (size_t pos = 0; pos < model_world.size(); pos++) {
-        DoGrowth(pos, model_world, next_model_world);
-      }
-      // Handle abiotic parameters and group repro
-      // There is no spatial structure / no diffusion.
-      for (size_t pos = 0; pos < model_world.size(); pos++) {
-        // (1) clearing - being removed?
-        // DoClearing(pos, model_world, next_model_world, prob_clear);
-        // (2) seeding
-        DoSeeding(pos, model_world, next_model_world, seeding_prob);
-      }
-
-      // Record world state
-      const bool final_update = (i == num_updates);
-      const bool res_update =  !(bool)(i % config->OUTPUT_RESOLUTION());
-      if (config->RECORD_ASSEMBLY_MODEL() && (final_update || res_update)) {
-        analysis_update = i;
-        assemblyWorldState = next_model_world;
-        assembly_data_file->Update();
+    // Recording needs the whole world at each recorded update, so step all cells together
+    if (config->RECORD_ASSEMBLY_MODEL()) {
+      emp::vector<emp::Random> cell_rnds;
+      cell_rnds.reserve(world_size);
+      for (size_t pos = 0; pos < world_size; ++pos) {
+        cell_rnds.emplace_back(utils::GetStreamSeed(cell_seed_base, pos));
       }
+      world_t next_model_world(model_world);
+
+      for (int i = 0; i < num_updates; i++) {
+        for (size_t pos = 0; pos < model_world.size(); pos++) {
+          // (1) growth
+          DoGrowth(pos, model_world, next_model_world);
+          // (2) seeding
+          DoSeeding(pos, model_world, next_model_world, seeding_prob, cell_rnds[pos]);
+        }
 
-      std::swap(model_world, next_model_world);
+        // Record world state
+        const bool final_update = (i == num_updates);
+        const bool res_update =  !(bool)(i % config->OUTPUT_RESOLUTION());
+        if (final_update || res_update) {
+          std::lock_guard<std::mutex> lock(model_recording_mutex);
+          stochastic_rep = rep;
+          analysis_update = i;
+          recorded_assembly_world = &next_model_world;
+          assembly_data_file->Update();
+          recorded_assembly_world = nullptr;
+        }
 
-      if (config->RECORD_ASSEMBLY_MODEL()) {
-        assemblyWorldState.clear();
+        std::swap(model_world, next_model_world);
       }
-
+      return model_world;
     }
 
+    // Otherwise, run each cell's trajectory to completion (keeping its state in a pair of
+    // small, cache-resident buffers)
+    utils::ParallelFor(0, world_size, num_threads, [&](size_t pos) {
+      emp::Random cell_rnd(utils::GetStreamSeed(cell_seed_base, pos));
+      thread_local emp::vector<double> cell;
+      thread_local emp::vector<double> next_cell;
+      cell.assign(N_TYPES, 0.0);
+      next_cell.assign(N_TYPES, 0.0);
+      for (int i = 0; i < num_updates; i++) {
+        DoCellGrowth(cell, next_cell);
+        DoCellSeeding(next_cell, seeding_prob, cell_rnd);
+        std::swap(cell, next_cell);
+      }
+      model_world[pos] = cell;
+    });
     return model_world;
   }
 
+  // Draws the value used to seed each assembly model cell's random number stream
+  int DrawCellSeedBase(emp::Random& random) {
+    return (int)random.GetUInt(std::numeric_limits<uint32_t>::max());
+  }
+
   world_t AdaptiveModel(
     int num_updates,
     double prob_clear,
     double seeding_prob
+  ) {
+    return AdaptiveModel(
+      num_updates,
+      prob_clear,
+      seeding_prob,
+      stochastic_rep,
+      rnd,
+      subcommunity_group_repro_schedule
+    );
+  }
+
+  // Runs the adaptive model for the given replicate using the given random number generator
+  // and sub-community group repro schedule.
+  // With PARALLEL_GROUP_REPRO, between-cell updates are spread across num_threads threads.
+  world_t AdaptiveModel(
+    int num_updates,
+    double prob_clear,
+    double seeding_prob,
+    size_t rep,
+    emp::Random& random,
+    emp::vector<size_t>& group_repro_schedule,
+    size_t num_threads=1
   ) {
     // Track current and next stochastic model worlds.
     world_t model_world(
@@ -947,6 +2087,16 @@ public:
     );
     world_t next_model_world(model_world);
 
+    // Two-phase between-cell updates (cells are activated in position order)
+    const bool parallel_group_repro = config->PARALLEL_GROUP_REPRO();
+    CellInteractionBuffers cell_buffers;
+    emp::vector<size_t> activation_order;
+    if (parallel_group_repro) {
+      SetupCellInteractionBuffers(cell_buffers, DrawCellSeedBase(random));
+      activation_order.resize(world_size);
+      std::iota(activation_order.begin(), activation_order.end(), 0);
+    }
+
     for (int i = 0; i < num_updates; i++) {
       // handle in cell growth
       for (size_t pos = 0; pos < model_world.size(); pos++) {
@@ -954,32 +2104,45 @@ public:
       }
       // Handle abiotic parameters and group repro
       // There is no spatial structure / no diffusion.
-      for (size_t pos = 0; pos < model_world.size(); pos++) {
-        // ORIGINAL DoRepro call:
-        //   DoRepro(pos, adj, model_world, next_model_world, config->SEEDING_PROB(), config->PROB_CLEAR(), diff, repro);
-        // (1) Group repro
-        DoGroupRepro(pos, model_world, next_model_world);
-        // (2) clearing
-        DoClearing(pos, model_world, next_model_world, prob_clear);
-        // (3) seeding
-        DoSeeding(pos, model_world, next_model_world, seeding_prob);
+      if (parallel_group_repro) {
+        DoCellInteractions(
+          model_world,
+          next_model_world,
+          activation_order,
+          cell_buffers,
+          true,
+          prob_clear,
+          0.0,
+          seeding_prob,
+          num_threads
+        );
+      } else {
+        for (size_t pos = 0; pos < model_world.size(); pos++) {
+          // ORIGINAL DoRepro call:
+          //   DoRepro(pos, adj, model_world, next_model_world, config->SEEDING_PROB(), config->PROB_CLEAR(), diff, repro);
+          // (1) Group repro
+          DoGroupRepro(pos, model_world, next_model_world, random, group_repro_schedule);
+          // (2) clearing
+          DoClearing(pos, model_world, next_model_world, prob_clear, random);
+          // (3) seeding
+          DoSeeding(pos, model_world, next_model_world, seeding_prob, random);
+        }
       }
 
       // Record world state
       const bool final_update = (i == num_updates);
       const bool res_update =  !(bool)(i % config->OUTPUT_RESOLUTION());
       if (config->RECORD_ADAPTIVE_MODEL() && (final_update || res_update)) {
+        std::lock_guard<std::mutex> lock(model_recording_mutex);
+        stochastic_rep = rep;
         analysis_update = i;
-        adaptiveWorldState = next_model_world;
+        recorded_adaptive_world = &next_model_world;
         adaptive_data_file->Update();
+        recorded_adaptive_world = nullptr;
       }
 
       std::swap(model_world, next_model_world);
 
-      if (config->RECORD_ADAPTIVE_MODEL()) {
-        adaptiveWorldState.clear();
-      }
-
     }
 
     return model_world;
@@ -1126,176 +2289,242 @@ void AEcoWorld::SetupSpatialStructure_Load(
 
 // Configures community summerizers
 void AEcoWorld::SetupCommunitySummarizers() {
-  emp_assert(community_summarizer_raw == nullptr);
-  emp_assert(community_summarizer_pwip == nullptr);
-  emp_assert(community_summarizer_ranked == nullptr);
-  emp_assert(community_summarizer_ranked_threshold == nullptr);
-  emp_assert(recorded_communities_assembly_raw == nullptr);
-  emp_assert(recorded_communities_adaptive_raw == nullptr);
-  emp_assert(recorded_communities_assembly_pwip == nullptr);
-  emp_assert(recorded_communities_adaptive_pwip == nullptr);
-  emp_assert(recorded_communities_assembly_ranked == nullptr);
-  emp_assert(recorded_communities_adaptive_ranked == nullptr);
-  emp_assert(recorded_communities_assembly_ranked_threshold == nullptr);
-  emp_assert(recorded_communities_adaptive_ranked_threshold == nullptr);
-
-  // Reports raw counts (with decimal components truncated)
-  community_summarizer_raw = emp::NewPtr<RecordedCommunitySummarizer>(
-    community_structure,
-    [](double count) -> bool { return count >= 1.0; }
+  emp_assert(community_summarizers == nullptr);
+  emp_assert(recorded_communities_assembly == nullptr);
+  emp_assert(recorded_communities_adaptive == nullptr);
+  emp_assert(recorded_communities_world == nullptr);
+
+  // Summarizes each community in one pass: raw counts (species with counts of at least 1 are
+  // present), species present with interaction paths to other present species (pwip), and
+  // dominance rankings (with and without rounding species below THRESHOLD_VALUE down)
+  community_summarizers = emp::NewPtr<RecordedCommunitySummarizerGroup>(community_structure, 1.0);
+  community_summarizers->SetPresenceCache(&presence_summary_cache);
+
+  // Configure recorded community sets for adaptive / assembly models
+  recorded_comm_key_fun = RecordedCommunitySets::GetCountsKey;
+  recorded_comm_ranks_key_fun = RecordedCommunitySets::GetRanksKey;
+
+  recorded_communities_assembly = emp::NewPtr<RecordedCommunitySets>(
+    recorded_comm_key_fun,
+    recorded_comm_ranks_key_fun
+  );
+  recorded_communities_adaptive = emp::NewPtr<RecordedCommunitySets>(
+    recorded_comm_key_fun,
+    recorded_comm_ranks_key_fun
   );
+  recorded_communities_world = emp::NewPtr<RecordedCommunitySets>(
+    recorded_comm_key_fun,
+    recorded_comm_ranks_key_fun
+  );
+
+  // Assembly/adaptive sets accumulate communities across every replicate, so they may need
+  // to be bounded (world sets never hold more communities than there are cells)
+  if (config->RECORDED_COMMUNITY_CAPACITY() > 0) {
+    recorded_communities_assembly->SetCapacity(config->RECORDED_COMMUNITY_CAPACITY(), config->RECORDED_COMMUNITY_SKETCH_WIDTH());
+    recorded_communities_adaptive->SetCapacity(config->RECORDED_COMMUNITY_CAPACITY(), config->RECORDED_COMMUNITY_SKETCH_WIDTH());
+  }
+}
 
-  // Removes species present that have no interactions with other present species
-  community_summarizer_pwip = emp::NewPtr<RecordedCommunitySummarizer>(
-    community_structure,
-    [](double count) -> bool { return count >= 1.0; },
-    emp::vector<RecordedCommunitySummarizer::summary_update_fun_t>{
-      KeepPresentWithInteractionPath
+void AEcoWorld::AnalyzeCommunities(
+  const world_t& analysis_world,
+  RecordedCommunitySets& recorded_communities,
+  StabilizationStats& stabilization_stats,
+  size_t num_threads
+) {
+  // Analyzes cells [begin, end), reusing per-cell buffers so that no intermediate worlds are built
+  auto analyze_cells = [this, &analysis_world](
+    size_t begin,
+    size_t end,
+    RecordedCommunitySets& communities,
+    StabilizationStats& stats
+  ) {
+    emp::vector<double> stable_cell(N_TYPES, 0.0);
+    CellCommunitySummaries summaries;
+    // Timed per chunk (rather than per cell) to keep clock reads out of the per-cell loop
+    const auto start_time = std::chrono::steady_clock::now();
+    for (size_t pos = begin; pos < end; ++pos) {
+      stable_cell = analysis_world[pos];
+      AnalyzeCell(pos, stable_cell, summaries, stats);
+      communities.Add(summaries);
     }
-  );
+    const std::chrono::duration<double> analysis_time = std::chrono::steady_clock::now() - start_time;
+    stats.seconds += analysis_time.count();
+  };
 
-  // Reports rankings 
-  community_summarizer_ranked = emp::NewPtr<RecordedCommunitySummarizer>(
-    community_structure,
-    [](double count) -> bool { return true; }
+  const size_t num_chunks = GetNumAnalysisChunks(analysis_world.size(), num_threads);
+  if (num_chunks <= 1) {
+    analyze_cells(0, analysis_world.size(), recorded_communities, stabilization_stats);
+    return;
+  }
+  emp::vector<RecordedCommunitySets> chunk_communities;
+  for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+    chunk_communities.emplace_back(recorded_comm_key_fun, recorded_comm_ranks_key_fun);
+  }
+  ForEachAnalysisChunk(
+    analysis_world.size(),
+    num_chunks,
+    num_threads,
+    stabilization_stats,
+    [&](size_t chunk, size_t begin, size_t end, StabilizationStats& chunk_stats) {
+      analyze_cells(begin, end, chunk_communities[chunk], chunk_stats);
+    }
   );
+  for (const auto& communities : chunk_communities) recorded_communities.Merge(communities);
+}
 
-  // Reports rankings rounded
-  community_summarizer_ranked_threshold = emp::NewPtr<RecordedCommunitySummarizer>(
-    community_structure,
-    [](double count) -> bool { return true; }
-  );
+void AEcoWorld::AnalyzeCell(
+  size_t pos,
+  emp::vector<double>& stable_cell,
+  CellCommunitySummaries& summaries,
+  StabilizationStats& stabilization_stats
+) {
+  // Scratch space (per-thread so cells can be analyzed concurrently)
+  thread_local emp::vector<double> scratch;
 
-  // Configure recorded community sets for adaptive / assembly models
-  recorded_comm_key_fun = [](
-    const RecordedCommunitySummary& summary
-  ) -> const auto& {
-    return summary.counts;
-  };
+  // Run cell forward without diffusion
+  const size_t max_updates = config->CELL_STABILIZATION_UPDATES();
+  const size_t updates = StabilizeCell(stable_cell, scratch, max_updates);
+  stabilization_stats.RecordCell(pos, updates, updates < max_updates);
 
-  recorded_communities_assembly_raw = emp::NewPtr<RecordedCommunitySet<emp::vector<double>>>(recorded_comm_key_fun);
-  recorded_communities_adaptive_raw = emp::NewPtr<RecordedCommunitySet<emp::vector<double>>>(recorded_comm_key_fun);
-  recorded_communities_assembly_pwip = emp::NewPtr<RecordedCommunitySet<emp::vector<double>>>(recorded_comm_key_fun);
-  recorded_communities_adaptive_pwip = emp::NewPtr<RecordedCommunitySet<emp::vector<double>>>(recorded_comm_key_fun);
-  recorded_communities_assembly_ranked = emp::NewPtr<RecordedCommunitySet<emp::vector<double>>>(recorded_comm_key_fun);
-  recorded_communities_adaptive_ranked = emp::NewPtr<RecordedCommunitySet<emp::vector<double>>>(recorded_comm_key_fun);
-  recorded_communities_assembly_ranked_threshold = emp::NewPtr<RecordedCommunitySet<emp::vector<double>>>(recorded_comm_key_fun);
-  recorded_communities_adaptive_ranked_threshold = emp::NewPtr<RecordedCommunitySet<emp::vector<double>>>(recorded_comm_key_fun);
+  SummarizeStableCell(stable_cell, summaries);
 }
 
-void AEcoWorld::AnalyzeWorldCommunities(
-  bool output_snapshots
+void AEcoWorld::SummarizeStableCell(
+  const emp::vector<double>& stable_cell,
+  CellCommunitySummaries& summaries
 ) {
-    // Run world forward without diffusion
-    world_t stable_world(
-      GenStabilizedWorld(world, config->CELL_STABILIZATION_UPDATES())
-    );
+  // Scratch space (per-thread so cells can be summarized concurrently)
+  thread_local emp::vector<rank_t> ranked_cell;
+  thread_local emp::vector<rank_t> ranked_threshold_cell;
 
-    world_t ranked_world(
-      GenRankedWorld(stable_world, false)
-    );
+  RankCell(stable_cell, ranked_cell, ranked_threshold_cell);
 
-    world_t ranked_threshold_world(
-      GenRankedWorld(stable_world, true)
-    );
+  // Ranked summaries report ranks as counts, but are identified by their compact ranks
+  community_summarizers->SummarizeCounts(stable_cell, summaries.raw, summaries.pwip);
+  community_summarizers->SummarizeRanks(ranked_cell, summaries.ranked);
+  community_summarizers->SummarizeRanks(ranked_threshold_cell, summaries.ranked_threshold);
+}
 
-    // NOTE (@AML): Not in total love with this; could possibly use another iteration after chatting
-    //   about future functionality that would be useful to have
-    // - Should all be managed together (to make it easier to add different summary strategies)
-    // RecordedCommunitySet<emp::vector<double>>::summary_key_fun_t recorded_comm_key_fun = [](
-    //   const RecordedCommunitySummary& summary
-    // ) -> const auto& {
-    //   return summary.counts;
-    // };
-
-    // Set of recorded communities with "raw" counts
-    RecordedCommunitySet<emp::vector<double>> recorded_communities_world_raw(recorded_comm_key_fun);
-    // RecordedCommunitySet<emp::vector<double>> recorded_communities_assembly_raw(recorded_comm_key_fun);
-    // RecordedCommunitySet<emp::vector<double>> recorded_communities_adaptive_raw(recorded_comm_key_fun);
-
-    // Set of recorded communities with counts that have had PNI-species zeroed-out
-    RecordedCommunitySet<emp::vector<double>> recorded_communities_world_pwip(recorded_comm_key_fun);
-    // RecordedCommunitySet<emp::vector<double>> recorded_communities_assembly_pwip(recorded_comm_key_fun);
-    // RecordedCommunitySet<emp::vector<double>> recorded_communities_adaptive_pwip(recorded_comm_key_fun);
-
-    // Set of species ranked by dominance
-    RecordedCommunitySet<emp::vector<double>> recorded_communities_ranked(recorded_comm_key_fun);
-
-    // Set of species ranked by dominance, with low numbers rounded down
-    RecordedCommunitySet<emp::vector<double>> recorded_communities_ranked_threshold(recorded_comm_key_fun);
-
-    // Add world summaries
-    recorded_communities_world_raw.Add(
-      community_summarizer_raw->SummarizeAll(stable_world)
-    );
-    recorded_communities_world_pwip.Add(
-      community_summarizer_pwip->SummarizeAll(stable_world)
-    );
-    recorded_communities_ranked.Add(
-      community_summarizer_ranked->SummarizeAll(ranked_world)
-    );
-    recorded_communities_ranked_threshold.Add(
-      community_summarizer_ranked_threshold->SummarizeAll(ranked_threshold_world)
-    );
+void AEcoWorld::RecordStabilization(
+  const std::string& source,
+  size_t rep,
+  size_t update,
+  const StabilizationStats& stats
+) {
+  stabilization_source = source;
+  stabilization_rep = rep;
+  stabilization_update = update;
+  cur_stabilization_stats = &stats;
+  stabilization_file->Update();
+  cur_stabilization_stats = nullptr;
+
+  stabilization_totals[source].Merge(stats);
+}
 
+void AEcoWorld::PrintApproximateCountingSummary(std::ostream& os) const {
+  os << "Approximate community counting summary:" << std::endl;
+  auto print_set = [&os](const std::string& name, const auto& community_set) {
+    os << "  " << name << ": " << community_set.GetSize() << " communities kept, "
+      << community_set.GetTotalCount() << " recorded (at most "
+      << community_set.GetUntrackedCount() << " in communities not kept); counts overstated by at most "
+      << community_set.GetCountErrorBound() << " (with probability 1 - e^-4)" << std::endl;
+  };
+  auto print_sets = [&print_set](const std::string& source, const RecordedCommunitySets& sets) {
+    print_set(source + " raw", sets.raw);
+    print_set(source + " pwip", sets.pwip);
+    print_set(source + " ranked", sets.ranked);
+    print_set(source + " ranked_threshold", sets.ranked_threshold);
+  };
+  print_sets("assembly", *recorded_communities_assembly);
+  print_sets("adaptive", *recorded_communities_adaptive);
+}
 
+void AEcoWorld::PrintStabilizationSummary(std::ostream& os) const {
+  os << "Stabilization summary:" << std::endl;
+  for (const auto& entry : stabilization_totals) {
+    os << "  " << entry.first << ":" << std::endl;
+    entry.second.Print(os, "    ");
+  }
+}
 
-    // Update world community file
-    world_community_summary_pwip_file->Update(
-      world_update,
-      recorded_communities_world_pwip,
-      *recorded_communities_assembly_pwip,
-      *recorded_communities_adaptive_pwip
+void AEcoWorld::AnalyzeWorldCommunities(
+  bool output_snapshots
+) {
+    // Summarize (stabilized, ranked) world communities
+    RecordedCommunitySets& world_communities = *recorded_communities_world;
+    StabilizationStats stabilization_stats;
+    world_communities.Clear();
+    AnalyzeCommunities(
+      world,
+      world_communities,
+      stabilization_stats,
+      utils::GetNumThreads(config->NUM_THREADS())
     );
+    RecordStabilization("world", 0, world_update, stabilization_stats);
+
+    // Update world community file
+    // Needs assembly/adaptive results, so if those are still being computed, hold onto a
+    // copy of the world's communities and write them out once results are in.
+    if (StochasticAnalysisRunning() && !output_snapshots) {
+      pending_world_communities_pwip.emplace_back(world_update, world_communities.pwip);
+    } else {
+      FinishStochasticAnalysis();
+      world_community_summary_pwip_file->Update(
+        world_update,
+        world_communities.pwip,
+        recorded_communities_assembly->pwip,
+        recorded_communities_adaptive->pwip
+      );
+    }
 
     if (output_snapshots) {
       // NOTE (@AML): Slightly clunky way to tie together things
       // Snapshot raw recorded community summaries
-      SnapshotRecordedCommunitySets</*SUMMARY_SET_KEY_T=*/emp::vector<double>>(
+      SnapshotRecordedCommunitySets</*SUMMARY_SET_KEY_T=*/summary_counts_t>(
         output_dir + "recorded_communities_raw_" + emp::to_string(world_update) + ".csv",
         {
-          {recorded_communities_world_raw, "world", true, config->UPDATES()},
-          {*recorded_communities_assembly_raw, "assembly", true, config->UPDATES()},
-          {*recorded_communities_adaptive_raw, "adaptive", true, config->UPDATES()}
+          {world_communities.raw, "world", true, config->UPDATES()},
+          {recorded_communities_assembly->raw, "assembly", true, config->UPDATES()},
+          {recorded_communities_adaptive->raw, "adaptive", true, config->UPDATES()}
         }
       );
 
       // Snapshot summaries where "present-no-interactions" species have been removed
-      SnapshotRecordedCommunitySets</*SUMMARY_SET_KEY_T=*/emp::vector<double>>(
+      SnapshotRecordedCommunitySets</*SUMMARY_SET_KEY_T=*/summary_counts_t>(
         output_dir + "recorded_communities_pwip_" + emp::to_string(world_update) + ".csv",
         {
-          {recorded_communities_world_pwip, "world", true, config->UPDATES()},
-          {*recorded_communities_assembly_pwip, "assembly", true, config->UPDATES()},
-          {*recorded_communities_adaptive_pwip, "adaptive", true, config->UPDATES()}
+          {world_communities.pwip, "world", true, config->UPDATES()},
+          {recorded_communities_assembly->pwip, "assembly", true, config->UPDATES()},
+          {recorded_communities_adaptive->pwip, "adaptive", true, config->UPDATES()}
         }
       );
 
-      SnapshotCommunitySetScores</*SUMMARY_SET_KEY_T=*/emp::vector<double>>(
+      SnapshotCommunitySetScores</*SUMMARY_SET_KEY_T=*/summary_counts_t>(
         output_dir + "recorded_communities_scores_pwip.csv",
-        {recorded_communities_world_pwip, "world", true, config->UPDATES()},
-        {*recorded_communities_assembly_pwip, "assembly", true, config->UPDATES()},
-        {*recorded_communities_adaptive_pwip, "adaptive", true, config->UPDATES()}
+        {world_communities.pwip, "world", true, config->UPDATES()},
+        {recorded_communities_assembly->pwip, "assembly", true, config->UPDATES()},
+        {recorded_communities_adaptive->pwip, "adaptive", true, config->UPDATES()}
       );
 
-      SnapshotCommunitySetScores</*SUMMARY_SET_KEY_T=*/emp::vector<double>>(
+      SnapshotCommunitySetScores</*SUMMARY_SET_KEY_T=*/summary_counts_t>(
         output_dir + "recorded_communities_scores_raw.csv",
-        {recorded_communities_world_raw, "world", true, config->UPDATES()},
-        {*recorded_communities_assembly_raw, "assembly", true, config->UPDATES()},
-        {*recorded_communities_adaptive_raw, "adaptive", true, config->UPDATES()}
+        {world_communities.raw, "world", true, config->UPDATES()},
+        {recorded_communities_assembly->raw, "assembly", true, config->UPDATES()},
+        {recorded_communities_adaptive->raw, "adaptive", true, config->UPDATES()}
       );
 
-      SnapshotCommunitySetScores</*SUMMARY_SET_KEY_T=*/emp::vector<double>>(
+      SnapshotCommunitySetScores</*SUMMARY_SET_KEY_T=*/summary_ranks_t>(
         output_dir + "ranked_communities_scores.csv",
-        {recorded_communities_ranked, "world", true, config->UPDATES()},
-        {*recorded_communities_assembly_ranked, "assembly", true, config->UPDATES()},
-        {*recorded_communities_adaptive_ranked, "adaptive", true, config->UPDATES()}
+        {world_communities.ranked, "world", true, config->UPDATES()},
+        {recorded_communities_assembly->ranked, "assembly", true, config->UPDATES()},
+        {recorded_communities_adaptive->ranked, "adaptive", true, config->UPDATES()}
       );
 
-      SnapshotCommunitySetScores</*SUMMARY_SET_KEY_T=*/emp::vector<double>>(
+      SnapshotCommunitySetScores</*SUMMARY_SET_KEY_T=*/summary_ranks_t>(
         output_dir + "ranked_threshold_communities_scores.csv",
-        {recorded_communities_ranked_threshold, "world", true, config->UPDATES()},
-        {*recorded_communities_assembly_ranked_threshold, "assembly", true, config->UPDATES()},
-        {*recorded_communities_adaptive_ranked_threshold, "adaptive", true, config->UPDATES()}
+        {world_communities.ranked_threshold, "world", true, config->UPDATES()},
+        {recorded_communities_assembly->ranked_threshold, "assembly", true, config->UPDATES()},
+        {recorded_communities_adaptive->ranked_threshold, "adaptive", true, config->UPDATES()}
       );
     }
 }
@@ -1324,7 +2553,8 @@ void AEcoWorld::SnapshotConfig() {
 
   // Snapshot misc. other details
   emp::vector<std::pair<std::string, std::string>> misc_params = {
-    std::make_pair("world_size", emp::to_string(world_size))
+    std::make_pair("world_size", emp::to_string(world_size)),
+    std::make_pair("stochastic_analysis_reps_used", emp::to_string(stochastic_analysis_reps_used))
     // Can add more param-value pairs here that are not included in config object
   };
 
@@ -1439,13 +2669,24 @@ void AEcoWorld::SnapshotRecordedCommunitySets(
   recorded_community_file.AddFun<double>(
     [&cur_set_id, &cur_summary_id, &community_sets]() -> double {
       const auto& community_set = community_sets[cur_set_id].summary_set;
-      emp_assert(emp::Sum(community_set.GetCommunityCounts()) > 0);
-      return (double)community_set.GetCommunityCount(cur_summary_id) / (double)emp::Sum(community_set.GetCommunityCounts());
+      emp_assert(community_set.GetTotalCount() > 0);
+      return (double)community_set.GetCommunityCount(cur_summary_id) / (double)community_set.GetTotalCount();
     },
     "proportion",
     "Proportion of cells where this particular community was found"
   );
 
+  // count_error (only when counts may be approximate)
+  if (config->RECORDED_COMMUNITY_CAPACITY() > 0) {
+    recorded_community_file.AddFun<size_t>(
+      [&cur_set_id, &cur_summary_id, &community_sets]() -> size_t {
+        return community_sets[cur_set_id].summary_set.GetCountError(cur_summary_id);
+      },
+      "count_error",
+      "Most this community's count may overstate its true count"
+    );
+  }
+
   // stabilized
   recorded_community_file.AddFun<bool>(
     [&cur_set_id, &cur_summary_id, &community_sets]() -> bool {
@@ -1475,7 +2716,7 @@ void AEcoWorld::SnapshotRecordedCommunitySets(
   recorded_community_file.AddFun<size_t>(
     [&cur_set_id, &cur_summary_id, &community_sets, this]() -> size_t {
       const auto& summary = community_sets[cur_set_id].summary_set.GetCommunitySummary(cur_summary_id);
-      return summary.present_with_interaction_path.CountOnes();
+      return summary.presence->present_with_interaction_path.CountOnes();
     },
     "num_present_with_interaction_path"
   );
@@ -1483,7 +2724,7 @@ void AEcoWorld::SnapshotRecordedCommunitySets(
   recorded_community_file.AddFun<size_t>(
     [&cur_set_id, &cur_summary_id, &community_sets, this]() -> size_t {
       const auto& summary = community_sets[cur_set_id].summary_set.GetCommunitySummary(cur_summary_id);
-      return summary.present_with_other_subcommunity_members.CountOnes();
+      return summary.presence->present_with_other_subcommunity_members.CountOnes();
     },
     "num_present_with_other_subcommunity_members"
   );
@@ -1492,7 +2733,7 @@ void AEcoWorld::SnapshotRecordedCommunitySets(
   recorded_community_file.AddFun<size_t>(
     [&cur_set_id, &cur_summary_id, &community_sets, this]() -> size_t {
       const auto& summary = community_sets[cur_set_id].summary_set.GetCommunitySummary(cur_summary_id);
-      return summary.counts.size();
+      return summary.GetNumPossibleSpecies();
     },
     "num_possible_species"
   );
@@ -1501,7 +2742,7 @@ void AEcoWorld::SnapshotRecordedCommunitySets(
   recorded_community_file.AddFun<std::string>(
     [&cur_set_id, &cur_summary_id, &community_sets, this]() -> std::string {
       const auto& summary = community_sets[cur_set_id].summary_set.GetCommunitySummary(cur_summary_id);
-      return emp::to_string(summary.counts);
+      return emp::to_string(summary.GetReportedCounts());
     },
     "species_counts"
   );
@@ -1510,7 +2751,7 @@ void AEcoWorld::SnapshotRecordedCommunitySets(
   recorded_community_file.AddFun<std::string>(
     [&cur_set_id, &cur_summary_id, &community_sets, this]() -> std::string {
       const auto& summary = community_sets[cur_set_id].summary_set.GetCommunitySummary(cur_summary_id);
-      return emp::to_string(summary.present_species_ids);
+      return emp::to_string(summary.presence->present_species_ids);
     },
     "present_species_ids"
   );
@@ -1519,7 +2760,7 @@ void AEcoWorld::SnapshotRecordedCommunitySets(
   recorded_community_file.AddFun<std::string>(
     [&cur_set_id, &cur_summary_id, &community_sets, this]() -> std::string {
       const auto& summary = community_sets[cur_set_id].summary_set.GetCommunitySummary(cur_summary_id);
-      return emp::to_string(summary.present);
+      return emp::to_string(summary.presence->present);
     },
     "present_species"
   );
@@ -1528,7 +2769,7 @@ void AEcoWorld::SnapshotRecordedCommunitySets(
   recorded_community_file.AddFun<std::string>(
     [&cur_set_id, &cur_summary_id, &community_sets, this]() -> std::string {
       const auto& summary = community_sets[cur_set_id].summary_set.GetCommunitySummary(cur_summary_id);
-      return emp::to_string(summary.present_with_interaction_path);
+      return emp::to_string(summary.presence->present_with_interaction_path);
     },
     "species_present_with_interaction_path"
   );
@@ -1536,7 +2777,7 @@ void AEcoWorld::SnapshotRecordedCommunitySets(
   recorded_community_file.AddFun<std::string>(
     [&cur_set_id, &cur_summary_id, &community_sets, this]() -> std::string {
       const auto& summary = community_sets[cur_set_id].summary_set.GetCommunitySummary(cur_summary_id);
-      return emp::to_string(summary.present_with_other_subcommunity_members);
+      return emp::to_string(summary.presence->present_with_other_subcommunity_members);
     },
     "species_present_with_other_subcommunity_members"
   );
@@ -1544,7 +2785,7 @@ void AEcoWorld::SnapshotRecordedCommunitySets(
   recorded_community_file.AddFun<size_t>(
     [&cur_set_id, &cur_summary_id, &community_sets, this]() -> size_t {
       const auto& summary = community_sets[cur_set_id].summary_set.GetCommunitySummary(cur_summary_id);
-      return summary.complete_subcommunities_present.size();
+      return summary.presence->complete_subcommunities_present.size();
     },
     "num_complete_subcommunities_present"
   );
@@ -1552,7 +2793,7 @@ void AEcoWorld::SnapshotRecordedCommunitySets(
   recorded_community_file.AddFun<size_t>(
     [&cur_set_id, &cur_summary_id, &community_sets, this]() -> size_t {
       const auto& summary = community_sets[cur_set_id].summary_set.GetCommunitySummary(cur_summary_id);
-      return summary.partial_subcommunities_present.size();
+      return summary.presence->partial_subcommunities_present.size();
     },
     "num_partial_subcommunities_present"
   );
@@ -1561,7 +2802,7 @@ void AEcoWorld::SnapshotRecordedCommunitySets(
   recorded_community_file.AddFun<std::string>(
     [&cur_set_id, &cur_summary_id, &community_sets, this]() -> std::string {
       const auto& summary = community_sets[cur_set_id].summary_set.GetCommunitySummary(cur_summary_id);
-      return emp::to_string(summary.complete_subcommunities_present);
+      return emp::to_string(summary.presence->complete_subcommunities_present);
     },
     "complete_subcommunities_present"
   );
@@ -1570,7 +2811,7 @@ void AEcoWorld::SnapshotRecordedCommunitySets(
   recorded_community_file.AddFun<std::string>(
     [&cur_set_id, &cur_summary_id, &community_sets, this]() -> std::string {
       const auto& summary = community_sets[cur_set_id].summary_set.GetCommunitySummary(cur_summary_id);
-      return emp::to_string(summary.partial_subcommunities_present);
+      return emp::to_string(summary.presence->partial_subcommunities_present);
     },
     "partial_subcommunities_present"
   );
@@ -1579,7 +2820,7 @@ void AEcoWorld::SnapshotRecordedCommunitySets(
   recorded_community_file.AddFun<std::string>(
     [&cur_set_id, &cur_summary_id, &community_sets, this]() -> std::string {
       const auto& summary = community_sets[cur_set_id].summary_set.GetCommunitySummary(cur_summary_id);
-      return emp::to_string(summary.proportion_subcommunity_present);
+      return emp::to_string(summary.presence->proportion_subcommunity_present);
     },
     "proportion_subcommunity_present"
   );
@@ -1608,7 +2849,7 @@ void AEcoWorld::SnapshotCommunitySetScores(
   recorded_community_file.AddFun<double>(
     [&world_community_set, &cur_summary_id]() -> double {
       const auto& community_set = world_community_set.summary_set;
-      return (double)community_set.GetCommunityCount(cur_summary_id) / (double)emp::Sum(community_set.GetCommunityCounts());
+      return (double)community_set.GetCommunityCount(cur_summary_id) / (double)community_set.GetTotalCount();
     },
     "proportion",
     "Proportion of cells where this particular community was found"
@@ -1625,7 +2866,7 @@ void AEcoWorld::SnapshotCommunitySetScores(
   recorded_community_file.AddFun<std::string>(
     [&world_community_set, &cur_summary_id, this]() -> std::string {
       const auto& summary = world_community_set.summary_set.GetCommunitySummary(cur_summary_id);
-      return emp::to_string(summary.counts);
+      return emp::to_string(summary.GetReportedCounts());
     },
     "species_counts"
   );
@@ -1633,7 +2874,7 @@ void AEcoWorld::SnapshotCommunitySetScores(
   recorded_community_file.AddFun<std::string>(
     [&world_community_set, &cur_summary_id, this]() -> std::string {
       const auto& summary = world_community_set.summary_set.GetCommunitySummary(cur_summary_id);
-      return emp::to_string(summary.present_species_ids);
+      return emp::to_string(summary.presence->present_species_ids);
     },
     "present_species_ids"
   );
@@ -1695,12 +2936,12 @@ void AEcoWorld::SnapshotCommunitySetScores(
         assembly_community_set.summary_set.GetSmoothedCommunityProportion(assembly_id.value()) :
         0.0;
       if (assembly_prop == 0) 
-        assembly_prop = 1/((double)emp::Sum(assembly_community_set.summary_set.GetCommunityCounts())+assembly_community_set.summary_set.GetCommunityCounts().size());
+        assembly_prop = assembly_community_set.summary_set.GetSmoothedAbsentCommunityProportion();
       double adaptive_prop = (adaptive_id) ?
         adaptive_community_set.summary_set.GetSmoothedCommunityProportion(adaptive_id.value()) :
         0.0;
       if (adaptive_prop == 0) 
-        adaptive_prop = 1/((double)emp::Sum(adaptive_community_set.summary_set.GetCommunityCounts())+adaptive_community_set.summary_set.GetCommunityCounts().size());
+        adaptive_prop = adaptive_community_set.summary_set.GetSmoothedAbsentCommunityProportion();
       return (assembly_prop != 0) ?
         emp::to_string(adaptive_prop / assembly_prop) :
         "error";
@@ -1708,66 +2949,46 @@ void AEcoWorld::SnapshotCommunitySetScores(
     "smooth_adaptive_assembly_ratio"
   );
 
+  // Additive and logged multiplicative scores summarize the whole world community set
+  // (same value on every line), so compute them once up front.
+  double additive_score = 1;
+  double summed_adaptive = 0;
+  double summed_assembly = 0;
+  for (size_t i = 0; i < world_community_set.summary_set.GetSize(); ++i) {
+    const auto& world_summary = world_community_set.summary_set.GetCommunitySummary(i);
+    const double world_prop = (double)world_community_set.summary_set.GetCommunityCount(i) / (double)world_community_set.summary_set.GetTotalCount();
+    const auto assembly_id = assembly_community_set.summary_set.GetCommunityID(world_summary);
+    const auto adaptive_id = adaptive_community_set.summary_set.GetCommunityID(world_summary);
+    double assembly_prop = (assembly_id) ?
+      assembly_community_set.summary_set.GetSmoothedCommunityProportion(assembly_id.value()) :
+      0.0;
+    if (assembly_prop == 0)
+      assembly_prop = assembly_community_set.summary_set.GetSmoothedAbsentCommunityProportion();
+    double adaptive_prop = (adaptive_id) ?
+      adaptive_community_set.summary_set.GetSmoothedCommunityProportion(adaptive_id.value()) :
+      0.0;
+    if (adaptive_prop == 0)
+      adaptive_prop = adaptive_community_set.summary_set.GetSmoothedAbsentCommunityProportion();
+    additive_score += world_prop * (adaptive_prop / assembly_prop);
+    // For each cell in the world, add the corresponding assembly/adaptive scores that many times
+    const double log_adaptive_prop = std::log(adaptive_prop);
+    const double log_assembly_prop = std::log(assembly_prop);
+    const size_t num_terms = utils::CountLoggedScoreTerms(world_prop);
+    for (size_t term = 0; term < num_terms; ++term) {
+      summed_adaptive += log_adaptive_prop;
+      summed_assembly += log_assembly_prop;
+    }
+  }
+  const std::string additive_score_str = emp::to_string(additive_score);
+  const std::string logged_mult_score_str = emp::to_string(summed_adaptive - summed_assembly);
+
   recorded_community_file.AddFun<std::string>(
-    [&world_community_set, &assembly_community_set, &adaptive_community_set, &cur_summary_id, this]() -> std::string {
-      emp::vector<double> community_scores;
-      for (size_t i = 0; i < world_community_set.summary_set.GetSize(); ++i) {
-        const auto& world_summary = world_community_set.summary_set.GetCommunitySummary(i);
-        const double world_prop = (double)world_community_set.summary_set.GetCommunityCount(i) / (double)emp::Sum(world_community_set.summary_set.GetCommunityCounts());
-        const auto assembly_id = assembly_community_set.summary_set.GetCommunityID(world_summary);
-        const auto adaptive_id = adaptive_community_set.summary_set.GetCommunityID(world_summary);
-        double assembly_prop = (assembly_id) ?
-          assembly_community_set.summary_set.GetSmoothedCommunityProportion(assembly_id.value()) :
-          0.0;
-        if (assembly_prop == 0) 
-          assembly_prop = 1/((double)emp::Sum(assembly_community_set.summary_set.GetCommunityCounts())+assembly_community_set.summary_set.GetCommunityCounts().size());
-        double adaptive_prop = (adaptive_id) ?
-          adaptive_community_set.summary_set.GetSmoothedCommunityProportion(adaptive_id.value()) :
-          0.0;
-        if (adaptive_prop == 0) 
-          adaptive_prop = 1/((double)emp::Sum(adaptive_community_set.summary_set.GetCommunityCounts())+adaptive_community_set.summary_set.GetCommunityCounts().size());
-        const double ratio = adaptive_prop / assembly_prop;
-        community_scores.push_back(world_prop*ratio);
-      }
-      double score = 1;
-      for (double s : community_scores) {
-        score += s;
-      }
-      return emp::to_string(score);
-    },
+    [&additive_score_str]() -> std::string { return additive_score_str; },
     "additive_score"
   );
 
-
   recorded_community_file.AddFun<std::string>(
-    [&world_community_set, &assembly_community_set, &adaptive_community_set, &cur_summary_id, this]() -> std::string {
-      emp::vector<double> community_scores;
-      double summed_adaptive = 0;
-      double summed_assembly = 0;
-      for (size_t i = 0; i < world_community_set.summary_set.GetSize(); ++i) {
-        const auto& world_summary = world_community_set.summary_set.GetCommunitySummary(i);
-        const double world_prop = (double)world_community_set.summary_set.GetCommunityCount(i) / (double)emp::Sum(world_community_set.summary_set.GetCommunityCounts());
-        const auto assembly_id = assembly_community_set.summary_set.GetCommunityID(world_summary);
-        const auto adaptive_id = adaptive_community_set.summary_set.GetCommunityID(world_summary);
-        double assembly_prop = (assembly_id) ?
-          assembly_community_set.summary_set.GetSmoothedCommunityProportion(assembly_id.value()) :
-          0.0;
-        if (assembly_prop == 0) 
-          assembly_prop = 1/((double)emp::Sum(assembly_community_set.summary_set.GetCommunityCounts())+assembly_community_set.summary_set.GetCommunityCounts().size());
-        double adaptive_prop = (adaptive_id) ?
-          adaptive_community_set.summary_set.GetSmoothedCommunityProportion(adaptive_id.value()) :
-          0.0;
-        if (adaptive_prop == 0) 
-          adaptive_prop = 1/((double)emp::Sum(adaptive_community_set.summary_set.GetCommunityCounts())+adaptive_community_set.summary_set.GetCommunityCounts().size());
-        // For each cell in the world, add the corresponding assembly/adaptive scores that many times
-        for(double j = 0.0; j < world_prop; j += .01){
-          summed_adaptive += log(adaptive_prop);
-          summed_assembly += log(assembly_prop);
-        }
-      }
-      double score = summed_adaptive - summed_assembly;
-      return emp::to_string(score);
-    },
+    [&logged_mult_score_str]() -> std::string { return logged_mult_score_str; },
     "logged_mult_score"
   );
 
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <deque>
+#include <cmath>
+#include <algorithm>
+#include <cstdint>
+
+#include "emp/base/vector.hpp"
+
+// This file defines:
+// - AssemblyStateGraph: exhaustive description of community assembly under seeding + stabilization
+
+namespace chemical_ecology {
+
+// Describes community assembly (seeding and growth, no spatial structure or clearing) as a
+// Markov chain over presence states (which species are present in a stabilized community),
+// starting from the empty community. Each step (one assembly model update), every absent
+// species seeds in independently with probability seed_prob (adding one individual), after
+// which the community is stabilized again.
+// This is an approximation of the assembly model, not an exact version of it:
+// - Seeding is treated as slow relative to growth (a community restabilizes between
+//   seeding events), and seeding an already-present species is assumed not to move a
+//   community to a different stable state.
+// - Seeding from a presence state always starts from that state's representative (the
+//   first stable community found with that set of species present). Presence states keep
+//   the graph bounded: with the usual stopping rule, slowly growing communities "stabilize"
+//   at many nearby counts.
+// Every distinct stable community a transition lands on is kept, though, so distributions
+// over communities (GetCommunityDistribution) do not merge communities that share a
+// presence state.
+// Only states reachable from the empty community are explored. Stabilization results are
+// memoized, so each distinct starting community is only stabilized once.
+class AssemblyStateGraph {
+public:
+  using cell_t = emp::vector<double>;
+  using presence_t = uint32_t;  // Bit i set if species i is present
+  // Stabilizes given cell in place (final counts should be rounded)
+  using stabilize_fun_t = std::function<void(cell_t&)>;
+  // Largest number of species we'll build a graph for (a state with k absent species has
+  // 2^k seeding outcomes, so up to 3^N stabilizations in total)
+  static constexpr size_t MAX_SPECIES = 10;
+
+protected:
+  emp::vector<cell_t> communities;                             // Each distinct stable community found (by community ID)
+  std::map<cell_t, size_t> community_ids;                      // Stable community => community ID
+  emp::vector<size_t> community_states;                        // Community ID => ID of its presence state
+  emp::vector<size_t> state_communities;                       // Presence state ID => representative community ID
+  std::map<presence_t, size_t> state_ids;                      // Presence => state ID
+  emp::vector<std::map<size_t, double>> transitions;           // Per-state transition probabilities (to community ID => probability)
+  std::map<cell_t, size_t> stabilized_community_ids;           // Memoized stabilizations (starting community => community ID)
+
+  // Get ID of the stable community that given (not necessarily stable) community
+  // stabilizes to. New presence states are queued for exploration.
+  size_t GetStabilizedCommunityID(
+    const cell_t& cell,
+    const stabilize_fun_t& stabilize,
+    std::deque<size_t>& unexplored
+  ) {
+    auto memo_it = stabilized_community_ids.find(cell);
+    if (memo_it != stabilized_community_ids.end()) return memo_it->second;
+
+    cell_t stable_cell(cell);
+    stabilize(stable_cell);
+    size_t community_id = communities.size();
+    auto community_it = community_ids.find(stable_cell);
+    if (community_it == community_ids.end()) {
+      const presence_t presence = GetPresence(stable_cell);
+      size_t state_id = state_communities.size();
+      auto state_it = state_ids.find(presence);
+      if (state_it == state_ids.end()) {
+        state_ids.emplace(presence, state_id);
+        state_communities.emplace_back(community_id);
+        transitions.emplace_back();
+        unexplored.emplace_back(state_id);
+      } else {
+        state_id = state_it->second;
+      }
+      community_ids.emplace(stable_cell, community_id);
+      communities.emplace_back(stable_cell);
+      community_states.emplace_back(state_id);
+    } else {
+      community_id = community_it->second;
+    }
+    stabilized_community_ids.emplace(cell, community_id);
+    return community_id;
+  }
+
+public:
+
+  static presence_t GetPresence(const cell_t& cell) {
+    emp_assert(cell.size() <= MAX_SPECIES);
+    presence_t presence = 0;
+    for (size_t i = 0; i < cell.size(); ++i) {
+      if (cell[i] > 0) presence |= ((presence_t)1 << i);
+    }
+    return presence;
+  }
+
+  void Clear() {
+    communities.clear();
+    community_ids.clear();
+    community_states.clear();
+    state_communities.clear();
+    state_ids.clear();
+    transitions.clear();
+    stabilized_community_ids.clear();
+  }
+
+  // Build graph of every presence state reachable from the empty community.
+  // State 0 (and community 0) is the stabilized empty community.
+  void Build(
+    size_t num_species,
+    double seed_prob,
+    double max_pop,
+    const stabilize_fun_t& stabilize
+  ) {
+    emp_assert(num_species <= MAX_SPECIES);
+    Clear();
+    std::deque<size_t> unexplored;
+    GetStabilizedCommunityID(cell_t(num_species, 0.0), stabilize, unexplored);
+
+    emp::vector<size_t> absent_ids;
+    cell_t seeded_cell;
+    while (!unexplored.empty()) {
+      const size_t state_id = unexplored.front();
+      unexplored.pop_front();
+      const size_t from_id = state_communities[state_id];
+
+      absent_ids.clear();
+      for (size_t i = 0; i < num_species; ++i) {
+        if (!(communities[from_id][i] > 0)) absent_ids.emplace_back(i);
+      }
+      const size_t num_absent = absent_ids.size();
+
+      // Try seeding in every (non-empty) subset of absent species
+      for (size_t subset = 1; subset < ((size_t)1 << num_absent); ++subset) {
+        seeded_cell = communities[from_id];
+        size_t num_seeded = 0;
+        for (size_t i = 0; i < num_absent; ++i) {
+          if ((subset >> i) & 1) {
+            seeded_cell[absent_ids[i]] = std::min(seeded_cell[absent_ids[i]] + 1, max_pop);
+            ++num_seeded;
+          }
+        }
+        const double prob = std::pow(seed_prob, num_seeded) * std::pow(1.0 - seed_prob, num_absent - num_seeded);
+        const size_t next_id = GetStabilizedCommunityID(seeded_cell, stabilize, unexplored);
+        transitions[state_id][next_id] += prob;
+      }
+      // Nothing seeds in
+      transitions[state_id][from_id] += std::pow(1.0 - seed_prob, num_absent);
+    }
+  }
+
+  size_t GetNumStates() const { return state_communities.size(); }
+
+  size_t GetNumCommunities() const { return communities.size(); }
+
+  // Number of distinct starting communities that have been stabilized
+  size_t GetNumStabilizations() const { return stabilized_community_ids.size(); }
+
+  const cell_t& GetCommunity(size_t community_id) const { return communities[community_id]; }
+
+  // Transition probabilities out of given presence state (to community ID => probability)
+  const std::map<size_t, double>& GetTransitions(size_t state_id) const {
+    return transitions[state_id];
+  }
+
+  // Probability distribution over communities after num_steps steps, starting from the
+  // empty community
+  emp::vector<double> GetCommunityDistribution(size_t num_steps) const {
+    emp::vector<double> community_dist(communities.size(), 0.0);
+    if (communities.empty()) return community_dist;
+    if (num_steps == 0) {
+      community_dist[0] = 1.0;
+      return community_dist;
+    }
+    // Step over presence states, keeping the communities reached on the last step
+    emp::vector<double> dist(state_communities.size(), 0.0);
+    dist[0] = 1.0;
+    for (size_t step = 0; step < num_steps; ++step) {
+      std::fill(community_dist.begin(), community_dist.end(), 0.0);
+      for (size_t from = 0; from < dist.size(); ++from) {
+        if (dist[from] == 0) continue;
+        for (const auto& transition : transitions[from]) {
+          community_dist[transition.first] += dist[from] * transition.second;
+        }
+      }
+      std::fill(dist.begin(), dist.end(), 0.0);
+      for (size_t community_id = 0; community_id < communities.size(); ++community_id) {
+        dist[community_states[community_id]] += community_dist[community_id];
+      }
+    }
+    return community_dist;
+  }
+};
+
+} // End chemical_ecology namespace
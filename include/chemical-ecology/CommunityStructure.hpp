@@ -27,6 +27,7 @@ protected:
 
   emp::vector<emp::BitVector> species_shares_subcommunity_with; // For each species, what other species does it share a subcommunity with
   emp::vector<emp::BitVector> species_interacts_with;    // For each species, what other species does it interact with?
+  bool symmetric_interactions = true;                    // Does every species interact with every species that interacts with it?
 
 public:
   CommunityStructure() = default;
@@ -121,6 +122,14 @@ public:
         shares_subcommunity[other_id] = true;
       }
     }
+    symmetric_interactions = true;
+    for (size_t spec_id = 0; spec_id < num_species; ++spec_id) {
+      for (size_t other_id = spec_id + 1; other_id < num_species; ++other_id) {
+        if (species_interacts_with[spec_id][other_id] != species_interacts_with[other_id][spec_id]) {
+          symmetric_interactions = false;
+        }
+      }
+    }
   }
 
   // Get number of species represented in community structure
@@ -144,6 +153,9 @@ public:
     return species_shares_subcommunity_with;
   }
 
+  // Is the interaction relation symmetric (the default InteractionMatrix interacts function is)?
+  bool HasSymmetricInteractions() const { return symmetric_interactions; }
+
   const emp::vector<emp::BitVector>& GetSpeciesInteractsWith() const {
     return species_interacts_with;
   }
@@ -180,6 +192,7 @@ public:
     subcommunity_fingerprints.clear();
     species_to_subcommunity_id.clear();
     num_species = 0;
+    symmetric_interactions = true;
     // species_interacts_with.clear();
   }
 
@@ -192,11 +205,11 @@ bool PathExists(
   const emp::BitVector& limit_path_to
 ) {
 
-  if (limit_path_to.None()) return false;
+  if (limit_path_to.None() || !limit_path_to[from]) return false;
 
   std::deque<size_t> next;
   std::unordered_set<size_t> discovered;
-  next.emplace_back((size_t)limit_path_to.FindOne());
+  next.emplace_back(from);
   discovered.emplace(next.back());
   emp_assert(next.back() < limit_path_to.size());
 
@@ -222,4 +235,60 @@ bool PathExists(
   return false;
 }
 
+// Find species in present that have an interaction path (only going through other species
+// in present) to at least one other species in present. I.e., members of the connected
+// components of the present species' interaction graph that contain more than one species.
+// Components are grown a whole BitVector at a time, by adding in the species that interact
+// with the component's newest members.
+// Components are only grown along outgoing interactions, so with an asymmetric interaction
+// relation (see CommunityStructure::HasSymmetricInteractions), a species' component would
+// depend on which member was found first. In that case, each present species is instead
+// checked against the other present species with PathExists.
+emp::BitVector FindPresentWithInteractionPath(
+  const CommunityStructure& community_structure,
+  const emp::BitVector& present
+) {
+  const auto& species_interacts_with = community_structure.GetSpeciesInteractsWith();
+  emp_assert(present.GetSize() == species_interacts_with.size());
+  emp::BitVector with_path(present.GetSize());
+
+  if (!community_structure.HasSymmetricInteractions()) {
+    for (int species_id = present.FindOne(); species_id >= 0; species_id = present.FindOne((size_t)species_id + 1)) {
+      for (int other_id = present.FindOne(); other_id >= 0; other_id = present.FindOne((size_t)other_id + 1)) {
+        if (other_id == species_id) continue;
+        if (PathExists(community_structure, (size_t)species_id, (size_t)other_id, present)) {
+          with_path.Set((size_t)species_id);
+          break;
+        }
+      }
+    }
+    return with_path;
+  }
+
+  emp::BitVector unvisited(present);
+  emp::BitVector component(present.GetSize());
+  emp::BitVector frontier(present.GetSize());
+  emp::BitVector reached(present.GetSize());
+
+  for (int root = unvisited.FindOne(); root >= 0; root = unvisited.FindOne()) {
+    component.Clear();
+    component.Set((size_t)root);
+    frontier = component;
+    unvisited.Set((size_t)root, false);
+    while (frontier.Any()) {
+      reached.Clear();
+      for (int species_id = frontier.FindOne(); species_id >= 0; species_id = frontier.FindOne((size_t)species_id + 1)) {
+        reached |= species_interacts_with[(size_t)species_id];
+      }
+      reached &= unvisited;
+      unvisited ^= reached; // reached only holds unvisited species
+      component |= reached;
+      frontier = reached;
+    }
+    if (component.CountOnes() > 1) with_path |= component;
+  }
+
+  return with_path;
+}
+
 } // End chemical_ecology namespace
\ No newline at end of file
@@ -18,6 +18,7 @@ namespace chemical_ecology {
     VALUE(REPRO_DILUTION, double, .1, "Proportion of contents to propogate on reproduction"),
     //Group repro enabled for all adaptive stochastic worlds under current architecture
     VALUE(GROUP_REPRO, bool, false, "True if proportional group level reproduction is enabled this run"),
+    VALUE(PARALLEL_GROUP_REPRO, bool, false, "Run between-cell updates (group repro, clearing, diffusion, seeding) in two phases (every cell proposes, then proposals are committed), using one random number stream per cell; runs on NUM_THREADS threads"),
     VALUE(V, bool, false, "True if running in verbose mode (Will print out all world vectors)"),
     VALUE(THRESHOLD_VALUE, double, 10.0, "Anything below threshold value will be rounded down for ranked threshold analysis"),
 
@@ -38,14 +39,26 @@ namespace chemical_ecology {
 
     GROUP(ANALYSIS_SETTINGS, "Settings related to post-hoc model analyses"),
     VALUE(STOCHASTIC_ANALYSIS_REPS, size_t, 10, "Number of times to run post-hoc stochastic analyses"),
+    VALUE(ADAPTIVE_STOCHASTIC_ANALYSIS_REPS, bool, false, "Keep running batches of STOCHASTIC_ANALYSIS_REPS replicates until community proportions stop changing?"),
+    VALUE(MAX_STOCHASTIC_ANALYSIS_REPS, size_t, 100, "Maximum number of replicates to run with ADAPTIVE_STOCHASTIC_ANALYSIS_REPS"),
+    VALUE(STOCHASTIC_ANALYSIS_REPS_TOLERANCE, double, 0.01, "With ADAPTIVE_STOCHASTIC_ANALYSIS_REPS, stop once no community proportion changes by more than this after a batch"),
+    VALUE(NUM_THREADS, size_t, 1, "Number of threads to use for parallel work, e.g., stochastic analysis replicates (0 = one per hardware thread)"),
+    VALUE(BASELINE_CACHE_DIR, std::string, "", "If set, assembly/adaptive model results are cached in (and loaded from) this directory, keyed by every setting they depend on"),
+    VALUE(ASSEMBLY_ANALYSIS_MODE, std::string, "stochastic", "How assembly model results are generated. Options: 'stochastic' (run assembly model replicates), 'exhaustive' (distribution after UPDATES steps over the graph of stable communities reachable by seeding, treating seeding as slow relative to growth; N_TYPES <= 10 only). Exhaustive results are approximate: each set of present species is seeded from one representative stable community, even if other stable communities share that set of species, and communities are recorded in proportion to their probability with as many cells as the stochastic replicates would use, so communities too rare to get a single cell are left out"),
+    VALUE(OVERLAP_STOCHASTIC_ANALYSIS, bool, false, "Run stochastic analysis replicates in the background while the main world runs? Replicates then run on their own NUM_THREADS threads alongside the main world's, so up to twice NUM_THREADS threads can be busy at once. Results are the same either way, but stabilization.csv lists the replicate rows after the world rows written while replicates ran (instead of before every world row)"),
     VALUE(CELL_STABILIZATION_UPDATES, size_t, 10000, "Number of updates to run growth for cell stabilization"),
-    VALUE(CELL_STABILIZATION_EPSILON, double, 0.0001, "If cell doesn't change more than this, can break stabilization early"),
+    VALUE(CELL_STABILIZATION_EPSILON, double, 0.0001, "Each cell stops stabilizing once its composition changes by less than this (Euclidean distance) in one update"),
+    VALUE(RECORDED_COMMUNITY_CAPACITY, size_t, 0, "Most distinct communities to keep in each assembly/adaptive recorded community set (0 = keep every community, counts are exact). When full, communities are counted approximately with a count-min sketch and only the most common are kept"),
+    VALUE(RECORDED_COMMUNITY_SKETCH_WIDTH, size_t, 0, "Counters per count-min sketch row with RECORDED_COMMUNITY_CAPACITY (0 = 8 per kept community). Counts are overstated by at most e/width of the total count (with probability 1 - e^-4)"),
 
     GROUP(OUTPUT_SETTINGS, "Settings related to data output"),
     VALUE(OUTPUT_DIR, std::string, "./output/", "What directory are we dumping data?"),
     VALUE(OUTPUT_RESOLUTION, size_t, 10, "How often should we output data?"),
     VALUE(RECORD_ASSEMBLY_MODEL, bool, false, "Should we output the assembly model updating over time?"),
     VALUE(RECORD_ADAPTIVE_MODEL, bool, false, "Should we output the adaptive model updating over time?"),
-    VALUE(RECORD_A_ECO_DATA, bool, false, "Should we output a-eco_data?")
+    VALUE(RECORD_A_ECO_DATA, bool, false, "Should we output a-eco_data?"),
+    VALUE(RECORD_STABILIZATION_CELL_UPDATES, bool, false, "Should stabilization.csv include the number of updates each cell needed to stabilize?"),
+    VALUE(CHECKPOINT_INTERVAL, size_t, 0, "Write a checkpoint (OUTPUT_DIR/checkpoint.bin) every this many updates, plus one after the stochastic analysis if it does not overlap the main world (0 = never). Resume with --resume. Checkpointing does not change results: resumed runs match uninterrupted runs, with or without checkpoints. A finished run can be extended by resuming with a larger UPDATES (the assembly/adaptive models, which run for UPDATES updates, are rerun; output written before the checkpoint is kept)"),
+    VALUE(EXPORT_RECORDED_COMMUNITIES, bool, false, "Write the assembly, adaptive, and final world recorded community sets to OUTPUT_DIR/recorded_communities.bin at the end of the run (exports from runs with the same interaction matrix can be combined with merge_communities)")
   );
 }
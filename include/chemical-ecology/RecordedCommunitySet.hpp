@@ -1,11 +1,15 @@
 #pragma once
 
 #include <functional>
-#include <map>
 #include <iostream>
 #include <string>
 #include <algorithm>
 #include <optional>
+#include <limits>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
 
 #include "emp/bits/BitVector.hpp"
 #include "emp/base/vector.hpp"
@@ -13,6 +17,8 @@
 #include "emp/tools/string_utils.hpp"
 
 #include "chemical-ecology/CommunityStructure.hpp"
+#include "chemical-ecology/RecordedCommunitySummarizer.hpp"
+#include "chemical-ecology/utils/serialization_utils.hpp"
 
 // This file defines:
 // - RecordedCommunitySummary: stores summary information about a recorded community
@@ -21,7 +27,15 @@
 namespace chemical_ecology {
 
 // Manages a set of RecordedCommunitySummary instances
-// TODO - test!
+// Summaries are indexed by key in an open-addressing (linear probing) hash table. Each summary's
+// key hash is stored alongside it, so keys are only compared when their hashes match.
+// By default, every distinct community is kept and counted exactly. With a capacity (see
+// SetCapacity), at most that many communities are kept: every community's count is also
+// tallied in a count-min sketch, and once the set is full, a new community replaces the
+// least-counted kept community only if its estimated count (from the sketch) is larger.
+// Kept communities are ordered in a min-heap by count, so the least-counted one is found
+// in constant time and replacing it takes O(log capacity).
+// Kept counts may then overstate true counts (see GetCountError and GetCountErrorBound).
 // NOTE (@AML): Set of existing accessors probably not complete. Added as needed by world.
 // NOTE (@AML): If you remove something from the set, size_t ids are no longer guaranteed to
 //              be the same before / after the remove
@@ -31,34 +45,298 @@ public:
   using summary_key_fun_t = std::function<const SUMMARY_KEY_T& (const RecordedCommunitySummary&)>;
 protected:
 
+  static constexpr size_t EMPTY_SLOT = (size_t)-1;
+  static constexpr size_t MIN_INDEX_SLOTS = 16;
+
   // REMINDER - summary IDs are not necessarily stable between adds! (Remove operations can change IDs)
   //  - I.e., don't give out internal summary IDs!
   emp::vector<RecordedCommunitySummary> summary_set;  // Stores recorded community summaries, *one* summary for each type added
   emp::vector<size_t> community_counts;               // How many of each recorded community "type" has been recorded?
-  std::map<SUMMARY_KEY_T, size_t> summary_id_map;     // Map summary keys to position in summaries vector
+  size_t total_count = 0;                             // Sum of community_counts (maintained as counts change)
+  emp::vector<uint64_t> summary_hashes;               // Key hash of each summary (by summary ID)
+  emp::vector<size_t> index_slots;                    // Hash index: summary ID in each slot (or EMPTY_SLOT). Size is a power of 2.
   summary_key_fun_t get_summary_key_fun;              // Given a summary, extracts component that uniquely identifies the summary
                                                       // Determines what recorded communities should be considered identical
 
+  // Approximate (bounded) mode
+  static constexpr size_t SKETCH_DEPTH = 4;
+  size_t capacity = 0;                                // Most communities kept (0 = no limit, counts are exact)
+  size_t sketch_width = 0;                            // Counters per sketch row
+  emp::vector<size_t> sketch;                         // Count-min sketch of all counts (SKETCH_DEPTH rows of sketch_width counters)
+  emp::vector<size_t> count_errors;                   // Most each kept community's count may overstate its true count
+  emp::vector<size_t> count_heap;                     // Min-heap of kept summary IDs (by count, then ID)
+  emp::vector<size_t> heap_positions;                 // Position of each summary ID in count_heap
+
+  // Bits of a single key value. Keys that compare equal must give equal bits.
+  template<typename T>
+  static uint64_t GetKeyValueBits(T value) {
+    if constexpr (std::is_floating_point<T>::value) {
+      static_assert(sizeof(T) <= sizeof(uint64_t));
+      if (value == 0) value = 0; // -0.0 == 0.0
+      uint64_t bits = 0;
+      std::memcpy(&bits, &value, sizeof(T));
+      return bits;
+    } else {
+      return (uint64_t)value;
+    }
+  }
+
+  static uint64_t HashKey(const SUMMARY_KEY_T& key) {
+    uint64_t hash = 0x9E3779B97F4A7C15ULL ^ (uint64_t)key.size();
+    for (const auto& value : key) {
+      // splitmix64-style mixing of each value into the running hash
+      uint64_t z = hash + GetKeyValueBits(value) + 0x9E3779B97F4A7C15ULL;
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+      hash = z ^ (z >> 31);
+    }
+    return hash;
+  }
+
+  size_t GetHomeSlot(uint64_t hash) const {
+    return (size_t)hash & (index_slots.size() - 1);
+  }
+
+  // Index slot holding summary with given key (or the empty slot where it would go)
+  size_t FindSlot(const SUMMARY_KEY_T& key, uint64_t hash) const {
+    emp_assert(index_slots.size() > 0);
+    const size_t mask = index_slots.size() - 1;
+    for (size_t slot = GetHomeSlot(hash); ; slot = (slot + 1) & mask) {
+      const size_t summary_id = index_slots[slot];
+      if (summary_id == EMPTY_SLOT) return slot;
+      if (summary_hashes[summary_id] == hash && get_summary_key_fun(summary_set[summary_id]) == key) return slot;
+    }
+  }
+
+  // Index slot holding given summary ID
+  size_t FindSlot(size_t summary_id) const {
+    const size_t mask = index_slots.size() - 1;
+    size_t slot = GetHomeSlot(summary_hashes[summary_id]);
+    while (index_slots[slot] != summary_id) {
+      emp_assert(index_slots[slot] != EMPTY_SLOT, "Summary not in index.");
+      slot = (slot + 1) & mask;
+    }
+    return slot;
+  }
+
+  // Rebuild index with given number of slots (must be a power of 2)
+  void ResizeIndex(size_t num_slots) {
+    emp_assert(num_slots > summary_set.size());
+    emp_assert((num_slots & (num_slots - 1)) == 0);
+    index_slots.assign(num_slots, EMPTY_SLOT);
+    const size_t mask = num_slots - 1;
+    for (size_t summary_id = 0; summary_id < summary_set.size(); ++summary_id) {
+      size_t slot = GetHomeSlot(summary_hashes[summary_id]);
+      while (index_slots[slot] != EMPTY_SLOT) slot = (slot + 1) & mask;
+      index_slots[slot] = summary_id;
+    }
+  }
+
+  // Empty the given index slot, shifting back any later entries in the same probe run so that
+  // every entry stays reachable from its home slot
+  void EraseSlot(size_t slot) {
+    const size_t mask = index_slots.size() - 1;
+    size_t next = (slot + 1) & mask;
+    while (index_slots[next] != EMPTY_SLOT) {
+      const size_t home = GetHomeSlot(summary_hashes[index_slots[next]]);
+      // Move entry back unless its home lies cyclically in (slot, next]
+      if (((next - home) & mask) >= ((next - slot) & mask)) {
+        index_slots[slot] = index_slots[next];
+        slot = next;
+      }
+      next = (next + 1) & mask;
+    }
+    index_slots[slot] = EMPTY_SLOT;
+  }
+
+  bool IsApproximate() const { return capacity > 0; }
+
+  // Heap order: smaller counts first (ties go to the smaller ID)
+  bool HeapLess(size_t id_a, size_t id_b) const {
+    if (community_counts[id_a] != community_counts[id_b]) {
+      return community_counts[id_a] < community_counts[id_b];
+    }
+    return id_a < id_b;
+  }
+
+  void SwapHeapPositions(size_t pos_a, size_t pos_b) {
+    std::swap(count_heap[pos_a], count_heap[pos_b]);
+    heap_positions[count_heap[pos_a]] = pos_a;
+    heap_positions[count_heap[pos_b]] = pos_b;
+  }
+
+  // Move heap entry at given position up or down until the heap is ordered again
+  void SiftHeap(size_t pos) {
+    while (pos > 0 && HeapLess(count_heap[pos], count_heap[(pos - 1) / 2])) {
+      SwapHeapPositions(pos, (pos - 1) / 2);
+      pos = (pos - 1) / 2;
+    }
+    while (true) {
+      size_t min_pos = pos;
+      for (size_t child = 2 * pos + 1; child <= 2 * pos + 2 && child < count_heap.size(); ++child) {
+        if (HeapLess(count_heap[child], count_heap[min_pos])) min_pos = child;
+      }
+      if (min_pos == pos) return;
+      SwapHeapPositions(pos, min_pos);
+      pos = min_pos;
+    }
+  }
+
+  // Restore heap order after the count (or ID) of given summary changed
+  void UpdateHeap(size_t summary_id) {
+    if (IsApproximate()) SiftHeap(heap_positions[summary_id]);
+  }
+
+  // Add newly kept summary (must be the last summary ID) to the heap
+  void PushHeap(size_t summary_id) {
+    if (!IsApproximate()) return;
+    emp_assert(summary_id == heap_positions.size());
+    heap_positions.emplace_back(count_heap.size());
+    count_heap.emplace_back(summary_id);
+    SiftHeap(heap_positions[summary_id]);
+  }
+
+  // Take given summary out of the heap (its heap position is left stale)
+  void EraseFromHeap(size_t summary_id) {
+    if (!IsApproximate()) return;
+    const size_t pos = heap_positions[summary_id];
+    SwapHeapPositions(pos, count_heap.size() - 1);
+    count_heap.pop_back();
+    if (pos < count_heap.size()) SiftHeap(pos);
+  }
+
+  // Rebuild the heap from scratch (e.g., after reading summaries without a capacity)
+  void RebuildHeap() {
+    count_heap.clear();
+    heap_positions.clear();
+    if (!IsApproximate()) return;
+    for (size_t summary_id = 0; summary_id < summary_set.size(); ++summary_id) PushHeap(summary_id);
+  }
+
+  // Sketch counter for given key hash in given row
+  size_t GetSketchIndex(uint64_t hash, size_t row) const {
+    uint64_t z = hash + (row + 1) * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z = z ^ (z >> 31);
+    return row * sketch_width + (size_t)(z % sketch_width);
+  }
+
+  void AddToSketch(uint64_t hash, size_t count) {
+    for (size_t row = 0; row < SKETCH_DEPTH; ++row) sketch[GetSketchIndex(hash, row)] += count;
+  }
+
+  void RemoveFromSketch(uint64_t hash, size_t count) {
+    for (size_t row = 0; row < SKETCH_DEPTH; ++row) {
+      size_t& counter = sketch[GetSketchIndex(hash, row)];
+      counter -= std::min(counter, count);
+    }
+  }
+
+  // Estimated count (never an underestimate) of community with given key hash
+  size_t GetSketchEstimate(uint64_t hash) const {
+    size_t estimate = std::numeric_limits<size_t>::max();
+    for (size_t row = 0; row < SKETCH_DEPTH; ++row) {
+      estimate = std::min(estimate, sketch[GetSketchIndex(hash, row)]);
+    }
+    return estimate;
+  }
+
+  // Add count (which may overstate the true count by up to count_error) to the community with
+  // given summary (whose key hashes to summary_hash). Does not update the total count or the sketch.
+  void Track(
+    const RecordedCommunitySummary& summary,
+    uint64_t summary_hash,
+    size_t community_count,
+    size_t count_error=0
+  ) {
+    const SUMMARY_KEY_T& summary_key = get_summary_key_fun(summary);
+    emp_assert(summary_hash == HashKey(summary_key));
+    // Keep index at most half full
+    if (2 * (summary_set.size() + 1) > index_slots.size()) {
+      ResizeIndex(std::max(MIN_INDEX_SLOTS, 2 * index_slots.size()));
+    }
+    const size_t slot = FindSlot(summary_key, summary_hash);
+    size_t summary_id = index_slots[slot];
+
+    // We've encountered this community type before
+    if (summary_id != EMPTY_SLOT) {
+      community_counts[summary_id] += community_count;
+      count_errors[summary_id] += count_error;
+      UpdateHeap(summary_id);
+      return;
+    }
+
+    // If the set is full, only keep this community if it (probably) outnumbers the
+    // least-counted kept community, which it then replaces (taking over its ID, so no other
+    // IDs change). Its count comes from the sketch, which covers everything recorded so far
+    // (including anything counted before it was kept).
+    if (IsApproximate() && summary_set.size() >= capacity) {
+      const size_t min_id = count_heap.front();
+      const size_t estimate = GetSketchEstimate(summary_hash);
+      if (estimate <= community_counts[min_id]) return;
+      // Entries may shift back when the replaced community leaves the index
+      EraseSlot(FindSlot(min_id));
+      index_slots[FindSlot(summary_key, summary_hash)] = min_id;
+      summary_set[min_id] = summary;
+      community_counts[min_id] = estimate;
+      count_errors[min_id] = estimate - (community_count - std::min(community_count, count_error));
+      summary_hashes[min_id] = summary_hash;
+      UpdateHeap(min_id);
+      return;
+    }
+
+    summary_id = summary_set.size();
+    index_slots[slot] = summary_id;
+    summary_set.emplace_back(summary);
+    community_counts.emplace_back(community_count);
+    count_errors.emplace_back(count_error);
+    summary_hashes.emplace_back(summary_hash);
+    PushHeap(summary_id);
+  }
+
   std::optional<size_t> GetCommunityID(const SUMMARY_KEY_T& key) const {
-    return (emp::Has(summary_id_map, key)) ? summary_id_map[key] : std::nullopt;
+    if (summary_set.empty()) return std::nullopt;
+    const size_t summary_id = index_slots[FindSlot(key, HashKey(key))];
+    return (summary_id == EMPTY_SLOT) ? std::nullopt : std::optional<size_t>{summary_id};
   }
 
-  // Removes summary with given ID, adjusts other IDs as necessary
+  // Removes summary with given ID (and its count), adjusts other IDs as necessary.
+  // Only the part of the count known to belong to this community (its count less its count
+  // error) is taken out of the total count and the sketch: the rest may have come from others.
   void Remove(size_t summary_id) {
     emp_assert(summary_id < summary_set.size());
+    const size_t removed_count = community_counts[summary_id] - std::min(community_counts[summary_id], count_errors[summary_id]);
+    total_count -= std::min(total_count, removed_count);
+    if (IsApproximate()) RemoveFromSketch(summary_hashes[summary_id], removed_count);
+    EraseFromHeap(summary_id);
     size_t back_id = summary_set.size() - 1;
+    // Removed summary should no longer be found by key
+    EraseSlot(FindSlot(summary_id));
     if (summary_id != back_id) {
       // Swap summary to be removed with summary with last id (to avoid changing more than one other ID)
-      const auto back_key = get_summary_key_fun(summary_set[back_id]);
       // Change the ID assocaited with the last item (it is about to be swapped forward)
-      summary_id_map[back_key] = summary_id;
+      index_slots[FindSlot(back_id)] = summary_id;
       // Swap the last summary in the set forward with the summary to be removed
       std::swap(summary_set[summary_id], summary_set[back_id]);
       std::swap(community_counts[summary_id], community_counts[back_id]);
+      std::swap(count_errors[summary_id], count_errors[back_id]);
+      std::swap(summary_hashes[summary_id], summary_hashes[back_id]);
+      // The last summary's heap entry now refers to its new ID
+      if (IsApproximate()) {
+        heap_positions[summary_id] = heap_positions[back_id];
+        count_heap[heap_positions[summary_id]] = summary_id;
+      }
     }
     // Summary to be removed should be last item in the vector
     summary_set.pop_back();
     community_counts.pop_back();
+    count_errors.pop_back();
+    summary_hashes.pop_back();
+    if (IsApproximate()) {
+      heap_positions.pop_back();
+      if (summary_id != back_id) UpdateHeap(summary_id);
+    }
   }
 
 public:
@@ -69,26 +347,45 @@ public:
     get_summary_key_fun(get_summary_key)
   { }
 
+  // Keep at most max_communities communities (0 = no limit), tallying counts in a count-min
+  // sketch with the given number of counters per row (0 = 8 per kept community). Counts
+  // are overstated by at most GetCountErrorBound() with probability 1 - e^-SKETCH_DEPTH.
+  // Should be set while the set is empty.
+  void SetCapacity(size_t max_communities, size_t counters_per_row=0) {
+    emp_assert(summary_set.empty());
+    capacity = max_communities;
+    sketch_width = (capacity == 0) ? 0 : ((counters_per_row > 0) ? counters_per_row : 8 * capacity);
+    sketch.assign(SKETCH_DEPTH * sketch_width, 0);
+  }
+
+  size_t GetCapacity() const { return capacity; }
+
+  // Clears set contents (keeps capacity)
   void Clear() {
     summary_set.clear();
     community_counts.clear();
-    summary_id_map.clear();
+    count_errors.clear();
+    total_count = 0;
+    summary_hashes.clear();
+    index_slots.clear();
+    std::fill(sketch.begin(), sketch.end(), 0);
+    count_heap.clear();
+    heap_positions.clear();
   }
 
   size_t GetSize() const {
-    emp_assert(summary_id_map.size() == summary_set.size());
+    emp_assert(summary_hashes.size() == summary_set.size());
     emp_assert(community_counts.size() == summary_set.size());
     return summary_set.size();
   }
 
   // Get numeric ID assigned to given summary
   std::optional<size_t> GetCommunityID(const RecordedCommunitySummary& summary) const {
-    const auto key = get_summary_key_fun(summary);
-    return (emp::Has(summary_id_map, key)) ? std::optional<size_t>{summary_id_map.at(key)} : std::nullopt;
+    return GetCommunityID(get_summary_key_fun(summary));
   }
 
   bool Has(const RecordedCommunitySummary& summary) const {
-    return emp::Has(summary_id_map, get_summary_key_fun(summary));
+    return GetCommunityID(summary).has_value();
   }
 
   const emp::vector<size_t>& GetCommunityCounts() const { return community_counts; }
@@ -97,14 +394,44 @@ public:
     return community_counts[id];
   }
 
+  // Total number of recorded communities (sum of all community counts)
+  size_t GetTotalCount() const { return total_count; }
+
   double GetCommunityProportion(size_t id) const {
-    emp_assert(emp::Sum(community_counts) > 0);
-    return (double)community_counts[id] / (double)emp::Sum(community_counts);
+    emp_assert(total_count > 0);
+    return (double)community_counts[id] / (double)total_count;
   }
 
   double GetSmoothedCommunityProportion(size_t id) const {
-    emp_assert(emp::Sum(community_counts) > 0);
-    return ((double)community_counts[id]+1) / ((double)emp::Sum(community_counts)+community_counts.size());
+    emp_assert(total_count > 0);
+    return ((double)community_counts[id]+1) / ((double)total_count+community_counts.size());
+  }
+
+  // Most the count of community with given ID may overstate its true count
+  size_t GetCountError(size_t id) const {
+    return count_errors[id];
+  }
+
+  // Count-min bound on how much any count may be overstated (from sketch collisions): with
+  // probability at least 1 - e^-SKETCH_DEPTH, a community's estimated count is within
+  // (e / sketch width) * total count of its true count. 0 if counts are exact.
+  size_t GetCountErrorBound() const {
+    if (!IsApproximate()) return 0;
+    return (size_t)std::ceil(std::exp(1.0) / (double)sketch_width * (double)total_count);
+  }
+
+  // Total count of communities that are not kept in the set (0 if counts are exact)
+  size_t GetUntrackedCount() const {
+    size_t tracked_count = 0;
+    for (size_t id = 0; id < community_counts.size(); ++id) {
+      tracked_count += community_counts[id] - std::min(community_counts[id], count_errors[id]);
+    }
+    return total_count - std::min(total_count, tracked_count);
+  }
+
+  // Smoothed proportion of a community type that is not in this set
+  double GetSmoothedAbsentCommunityProportion() const {
+    return 1 / ((double)total_count+community_counts.size());
   }
 
   const RecordedCommunitySummary& GetCommunitySummary(size_t id) const {
@@ -112,21 +439,10 @@ public:
   }
 
   void Add(const RecordedCommunitySummary& summary, size_t community_count=1) {
-    const auto summary_key = get_summary_key_fun(summary);
-    size_t summary_id = 0;
-
-    // If we haven't encounted this community type before, add to set.
-    // Otherwise, get the correct id
-    if (!emp::Has(summary_id_map, summary_key)) {
-      summary_id = summary_set.size();
-      summary_id_map[summary_key] = summary_id;
-      summary_set.emplace_back(summary);
-      community_counts.emplace_back(0);
-    } else {
-      summary_id = summary_id_map[summary_key];
-    }
-
-    community_counts[summary_id] += community_count;
+    const uint64_t summary_hash = HashKey(get_summary_key_fun(summary));
+    if (IsApproximate()) AddToSketch(summary_hash, community_count);
+    Track(summary, summary_hash, community_count);
+    total_count += community_count;
   }
 
   // Add multiple summaries at once (each entry will increment associated community count by 1)
@@ -136,28 +452,110 @@ public:
     }
   }
 
+  // Add all recorded communities (with their counts) from another set.
+  // Community types that are new to this set are added in the other set's ID order, so
+  // merging sets in a fixed order gives the same result as adding their summaries
+  // one-by-one in that order.
+  // Merging two bounded sets with the same sketch width combines their sketches. Otherwise,
+  // communities that other did not keep only add to this set's total count.
+  // Kept counts carry their count errors over, and the total count grows by other's total count.
+  void Merge(const RecordedCommunitySet& other) {
+    const bool merge_sketches = IsApproximate() && other.IsApproximate() && sketch_width == other.sketch_width;
+    if (merge_sketches) {
+      for (size_t i = 0; i < sketch.size(); ++i) sketch[i] += other.sketch[i];
+    }
+    for (size_t id = 0; id < other.summary_set.size(); ++id) {
+      const uint64_t summary_hash = other.summary_hashes[id];
+      if (IsApproximate() && !merge_sketches) AddToSketch(summary_hash, other.community_counts[id]);
+      Track(other.summary_set[id], summary_hash, other.community_counts[id], other.count_errors[id]);
+    }
+    total_count += other.total_count;
+  }
+
+  // Write set contents (summaries and their counts, plus capacity and sketch) in a binary
+  // format (readable by Deserialize)
+  void Serialize(std::ostream& os) const {
+    utils::WriteBinary(os, (uint64_t)summary_set.size());
+    for (size_t id = 0; id < summary_set.size(); ++id) {
+      summary_set[id].Serialize(os);
+      utils::WriteBinary(os, (uint64_t)community_counts[id]);
+      utils::WriteBinary(os, (uint64_t)count_errors[id]);
+    }
+    utils::WriteBinary(os, (uint64_t)total_count);
+    utils::WriteBinary(os, (uint64_t)capacity);
+    utils::WriteBinary(os, (uint64_t)sketch_width);
+    utils::WriteBinary(os, sketch);
+  }
+
+  // Replace set contents (and capacity) with those written by Serialize.
+  // Summaries in the set with the same species present share presence information.
+  // Returns false (leaving the set empty, with no capacity) if the stream did not contain a full set.
+  bool Deserialize(std::istream& is) {
+    auto fail = [this]() {
+      Clear();
+      SetCapacity(0);
+      return false;
+    };
+    // Read summaries as if there were no capacity (they all fit)
+    Clear();
+    SetCapacity(0);
+    uint64_t num_summaries = 0;
+    if (!utils::ReadBinary(is, num_summaries)) return fail();
+    PresenceSummaryCache presence_summaries(std::numeric_limits<size_t>::max());
+    RecordedCommunitySummary summary;
+    for (uint64_t i = 0; i < num_summaries; ++i) {
+      uint64_t count = 0;
+      uint64_t count_error = 0;
+      if (!summary.Deserialize(is) || !utils::ReadBinary(is, count) || !utils::ReadBinary(is, count_error)) {
+        return fail();
+      }
+      summary.presence = presence_summaries.Add(summary.presence);
+      Track(summary, HashKey(get_summary_key_fun(summary)), count, count_error);
+    }
+    uint64_t values[3];
+    for (uint64_t& value : values) {
+      if (!utils::ReadBinary(is, value)) return fail();
+    }
+    if (!utils::ReadBinary(is, sketch) || sketch.size() != SKETCH_DEPTH * values[2]) return fail();
+    total_count = values[0];
+    capacity = values[1];
+    sketch_width = values[2];
+    RebuildHeap();
+    return true;
+  }
+
   // Remove 'remove_count' number of recorded communities of specified type
+  // (in a bounded set, the community may not have been kept, in which case only the total
+  // count and sketch change)
   void Remove(const RecordedCommunitySummary& summary, size_t remove_count) {
-    const auto summary_key = get_summary_key_fun(summary);
-    emp_assert(emp::Has(summary_id_map, summary_key), "Summary not in set.");
+    const auto summary_id_opt = GetCommunityID(summary);
+    if (IsApproximate() && !summary_id_opt.has_value()) {
+      RemoveFromSketch(HashKey(get_summary_key_fun(summary)), remove_count);
+      total_count -= std::min(total_count, remove_count);
+      return;
+    }
+    emp_assert(summary_id_opt.has_value(), "Summary not in set.");
 
-    const size_t summary_id = summary_id_map[summary_key];
+    const size_t summary_id = *summary_id_opt;
     const size_t prev_count = community_counts[summary_id];
     // If asked to remove more than we have, delete the community all-together
     if (remove_count >= prev_count) {
       Remove(summary_id);
     } else {
       community_counts[summary_id] -= remove_count;
+      total_count -= remove_count;
+      UpdateHeap(summary_id);
+      if (IsApproximate()) RemoveFromSketch(summary_hashes[summary_id], remove_count);
     }
   }
 
   // Completely removes summary from set (regardless of current summary count)
   // - Note that this is a somewhat expensive operation
   void Remove(const RecordedCommunitySummary& summary) {
-    const auto summary_key = get_summary_key_fun(summary);
-    emp_assert(emp::Has(summary_id_map, summary_key), "Summary not in set.");
-    const size_t summary_id = summary_id_map[summary_key];
-    Remove(summary_id);
+    const auto summary_id = GetCommunityID(summary);
+    if (IsApproximate() && !summary_id.has_value()) return;
+    emp_assert(summary_id.has_value(), "Summary not in set.");
+    Remove(*summary_id);
   }
 
 }; // End of RecordedCommunitySet definition
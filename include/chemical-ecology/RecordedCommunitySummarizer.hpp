@@ -5,6 +5,12 @@
 #include <iostream>
 #include <string>
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
 
 #include "emp/bits/BitVector.hpp"
 #include "emp/base/vector.hpp"
@@ -14,6 +20,8 @@
 
 #include "chemical-ecology/CommunityStructure.hpp"
 #include "chemical-ecology/RecordedCommunitySummarizer.hpp"
+#include "chemical-ecology/utils/serialization_utils.hpp"
+#include "chemical-ecology/utils/thread_utils.hpp"
 
 // TODO - clean things up with an interaction matrix class
 
@@ -23,62 +31,283 @@ namespace chemical_ecology {
 struct RecordedCommunitySummary;
 class RecordedCommunitySummarizer;
 
-// TODO - make class, protect member variables?
-struct RecordedCommunitySummary {
-  emp::vector<double> counts;               // Species counts - this should uniquely identify this community (in the context of a RecordedCommunitySet)
-  emp::vector<size_t> present_species_ids;  // List of species IDs present in this recorded community
-  emp::BitVector present;                   // BitVector describing presence/absence of each species
+// Species dominance rank (1 is most abundant)
+using rank_t = uint16_t;
 
+// Per-summary species counts and ranks keep up to this many species inline (no heap allocation)
+constexpr size_t SUMMARY_INLINE_SPECIES = 12;
+using summary_counts_t = utils::SmallVector<double, SUMMARY_INLINE_SPECIES>;
+using summary_ranks_t = utils::SmallVector<rank_t, SUMMARY_INLINE_SPECIES>;
+
+// Summary information that only depends on which species are present (not on their counts).
+// Shared (read-only) by every summary with the same species present.
+struct PresenceSummary {
+  emp::BitVector present;                                 // BitVector describing presence/absence of each species
+  emp::vector<size_t> present_species_ids;                // List of species IDs present
   emp::BitVector present_with_other_subcommunity_members; // Species present with at least one other members of their subcommunity
-  emp::BitVector present_with_interaction_path;   // Species present with at least one valid interaction path to another species present
+  emp::BitVector present_with_interaction_path;           // Species present with at least one valid interaction path to another species present
+  emp::vector<size_t> complete_subcommunities_present;    // IDs of complete subcommunity structures present
+                                                          //   IDs come from given CommunityStructure instance
+  emp::vector<size_t> partial_subcommunities_present;     // IDs of partial subcommunity structures present
+                                                          //   IDs come from given CommunityStructure instance
+  emp::vector<double> proportion_subcommunity_present;    // Proportion of each subcommunity structure present
 
-  emp::vector<size_t> complete_subcommunities_present; // IDs of complete subcommunity structures present in this recorded community
-                                                       //   IDs come from given CommunityStructure instance
-  emp::vector<size_t> partial_subcommunities_present;  // IDs of partial subcommunity structures present in this recorded community
-                                                       //   IDs come from given CommunityStructure instance
-  emp::vector<double> proportion_subcommunity_present; // Proportion of each subcommunity structure present in recorded community
+  void Serialize(std::ostream& os) const {
+    utils::WriteBinary(os, present);
+    utils::WriteBinary(os, present_with_other_subcommunity_members);
+    utils::WriteBinary(os, present_with_interaction_path);
+    utils::WriteBinary(os, complete_subcommunities_present);
+    utils::WriteBinary(os, partial_subcommunities_present);
+    utils::WriteBinary(os, proportion_subcommunity_present);
+  }
+
+  // Read presence summary written by Serialize (present_species_ids are rebuilt from present).
+  // Returns false if stream did not contain a full presence summary.
+  bool Deserialize(std::istream& is) {
+    if (!(utils::ReadBinary(is, present)
+      && utils::ReadBinary(is, present_with_other_subcommunity_members)
+      && utils::ReadBinary(is, present_with_interaction_path)
+      && utils::ReadBinary(is, complete_subcommunities_present)
+      && utils::ReadBinary(is, partial_subcommunities_present)
+      && utils::ReadBinary(is, proportion_subcommunity_present))) return false;
+    present_species_ids.clear();
+    for (size_t mem_i = 0; mem_i < present.GetSize(); ++mem_i) {
+      if (present[mem_i]) present_species_ids.emplace_back(mem_i);
+    }
+    return true;
+  }
+};
+
+using presence_summary_ptr_t = std::shared_ptr<const PresenceSummary>;
+
+// TODO - make class, protect member variables?
+struct RecordedCommunitySummary {
+  summary_counts_t counts;                  // Species counts - this should uniquely identify this community (in the context of a RecordedCommunitySet)
+                                            //   (empty for summaries of ranked communities, which are identified by their ranks)
+  summary_ranks_t ranks;                    // Species dominance ranks (only filled in for summaries of ranked communities)
+  presence_summary_ptr_t presence;          // Presence-derived information (shared with other summaries with the same species present)
 
   bool operator<(const RecordedCommunitySummary& other) const {
-    return counts < other.counts;
+    return (counts == other.counts) ? ranks < other.ranks : counts < other.counts;
   }
 
   void Reset(size_t num_members=0) {
-    (present.Resize(num_members)).Clear();
-    (present_with_other_subcommunity_members.Resize(num_members)).Clear();
-    (present_with_interaction_path.Resize(num_members)).Clear();
-    present_species_ids.clear();
     counts.clear();
     counts.resize(num_members, 0);
-    complete_subcommunities_present.clear();
-    partial_subcommunities_present.clear();
-    proportion_subcommunity_present.clear();
+    ranks.clear();
+    presence = nullptr;
   }
 
   // Get number of distinct species present in this summarized community
-  size_t GetNumSpeciesPresent() const { return present_species_ids.size(); }
+  size_t GetNumSpeciesPresent() const { return presence->present_species_ids.size(); }
+
+  // Get number of species this community could contain
+  size_t GetNumPossibleSpecies() const { return ranks.empty() ? counts.size() : ranks.size(); }
+
+  // Species counts as reported in output (ranked communities report their ranks as counts)
+  emp::vector<double> GetReportedCounts() const {
+    return ranks.empty() ?
+      emp::vector<double>(counts.begin(), counts.end()) :
+      emp::vector<double>(ranks.begin(), ranks.end());
+  }
 
   size_t GetPopulationSize() const {
-    return emp::Sum(counts);
+    return (size_t)std::accumulate(counts.begin(), counts.end(), 0.0);
   }
 
   size_t GetNumCompleteSubCommunities() const {
-    return complete_subcommunities_present.size();
+    return presence->complete_subcommunities_present.size();
+  }
+
+  // Write summary in a binary format (readable by Deserialize)
+  void Serialize(std::ostream& os) const {
+    emp_assert(presence != nullptr);
+    utils::WriteBinary(os, counts);
+    utils::WriteBinary(os, ranks);
+    presence->Serialize(os);
+  }
+
+  // Read summary written by Serialize. Returns false if stream did not contain a full summary.
+  // Summaries read this way do not share presence information (see RecordedCommunitySet::Deserialize).
+  bool Deserialize(std::istream& is) {
+    auto presence_summary = std::make_shared<PresenceSummary>();
+    if (!(utils::ReadBinary(is, counts)
+      && utils::ReadBinary(is, ranks)
+      && presence_summary->Deserialize(is))) return false;
+    presence = std::move(presence_summary);
+    return true;
   }
 
   // "Pretty" print the summary in a human-readable format
   void Print(std::ostream & os=std::cout, const std::string& prefix = "") const {
     os << prefix << "Community composition: ";
-    emp::Print(counts, os);
+    emp::Print(GetReportedCounts(), os);
     os << std::endl;
-    os << prefix << "Present: " << present << std::endl;
-    os << prefix << "Present (with at least one other member of subcommunity): " << present_with_other_subcommunity_members << std::endl;
-    os << prefix << "Present (with at least one valid interaction path): " << present_with_interaction_path << std::endl;
+    os << prefix << "Present: " << presence->present << std::endl;
+    os << prefix << "Present (with at least one other member of subcommunity): " << presence->present_with_other_subcommunity_members << std::endl;
+    os << prefix << "Present (with at least one valid interaction path): " << presence->present_with_interaction_path << std::endl;
     os << prefix << "Subcommunities present (\% of subcommunity): ";
-    emp::Print(proportion_subcommunity_present, os);
+    emp::Print(presence->proportion_subcommunity_present, os);
     os << std::endl;
   }
 };
 
+// Caches presence summaries by presence pattern, so that summaries with the same species
+// present share one copy of their presence information. Can be shared by any summarizers
+// that use the same community structure (e.g., raw and pwip summarizers), including
+// summarizers used from different threads.
+// Patterns are spread over NUM_SHARDS independently locked shards (by pattern hash), so
+// threads summarizing different patterns rarely wait on each other.
+// Holds at most max_cache_entries patterns (split evenly between shards); once a shard is
+// full, that shard starts over (summaries that already hold a presence summary keep it).
+class PresenceSummaryCache {
+public:
+  static constexpr size_t NUM_SHARDS = 16;
+
+protected:
+  struct Shard {
+    std::map<emp::BitVector, presence_summary_ptr_t> presence_summaries;
+    size_t num_hits = 0;
+    size_t num_misses = 0;
+    mutable std::mutex shard_mutex;
+  };
+
+  std::array<Shard, NUM_SHARDS> shards;
+  size_t max_shard_entries;
+
+  Shard& GetShard(const emp::BitVector& present) {
+    return shards[present.Hash() % NUM_SHARDS];
+  }
+
+  // Sum of given shard statistic over all shards
+  template<typename FUN>
+  size_t SumShards(FUN&& get_value) const {
+    size_t total = 0;
+    for (const Shard& shard : shards) {
+      std::lock_guard<std::mutex> lock(shard.shard_mutex);
+      total += get_value(shard);
+    }
+    return total;
+  }
+
+public:
+  PresenceSummaryCache(size_t max_cache_entries=65536) :
+    max_shard_entries(std::max<size_t>(1, max_cache_entries / NUM_SHARDS))
+  { }
+
+  // Get cached summary for the given presence pattern (nullptr if the pattern is not cached)
+  presence_summary_ptr_t Get(const emp::BitVector& present) {
+    Shard& shard = GetShard(present);
+    std::lock_guard<std::mutex> lock(shard.shard_mutex);
+    auto it = shard.presence_summaries.find(present);
+    if (it == shard.presence_summaries.end()) {
+      ++shard.num_misses;
+      return nullptr;
+    }
+    ++shard.num_hits;
+    return it->second;
+  }
+
+  // Add presence summary to cache. If its pattern is already cached (e.g., added concurrently
+  // by another thread), returns the cached summary instead.
+  presence_summary_ptr_t Add(presence_summary_ptr_t presence_summary) {
+    Shard& shard = GetShard(presence_summary->present);
+    std::lock_guard<std::mutex> lock(shard.shard_mutex);
+    if (shard.presence_summaries.size() >= max_shard_entries) shard.presence_summaries.clear();
+    return shard.presence_summaries.emplace(presence_summary->present, presence_summary).first->second;
+  }
+
+  void Clear() {
+    for (Shard& shard : shards) {
+      std::lock_guard<std::mutex> lock(shard.shard_mutex);
+      shard.presence_summaries.clear();
+      shard.num_hits = 0;
+      shard.num_misses = 0;
+    }
+  }
+
+  size_t GetSize() const {
+    return SumShards([](const Shard& shard) { return shard.presence_summaries.size(); });
+  }
+
+  size_t GetNumHits() const {
+    return SumShards([](const Shard& shard) { return shard.num_hits; });
+  }
+
+  size_t GetNumMisses() const {
+    return SumShards([](const Shard& shard) { return shard.num_misses; });
+  }
+};
+
+// Summarize everything about a community that only depends on which species are present
+inline PresenceSummary SummarizePresence(
+  const CommunityStructure& community_structure,
+  const emp::BitVector& present
+) {
+  PresenceSummary presence_summary;
+  presence_summary.present = present;
+  const size_t num_members = present.GetSize();
+  (presence_summary.present_with_other_subcommunity_members.Resize(num_members)).Clear();
+  for (size_t mem_i = 0; mem_i < num_members; ++mem_i) {
+    if (present[mem_i]) presence_summary.present_species_ids.emplace_back(mem_i);
+  }
+
+  // Identify members that are present with no other members of their subcommunity
+  for (size_t mem_i : presence_summary.present_species_ids) {
+    emp_assert(present[mem_i]);
+    const size_t member_comm_id = community_structure.GetSubCommunityID(mem_i);
+    const auto& subcommunity = community_structure.GetSubCommunityPresent(member_comm_id);
+    emp_assert(subcommunity[mem_i]);
+    // Does this member species have other species present that share a community?
+    // I.e., are there more than one species of this subcommunity present?
+    const size_t num_subcomm_present = (present & subcommunity).CountOnes();
+    presence_summary.present_with_other_subcommunity_members[mem_i] = num_subcomm_present > 1;
+  }
+
+  // Idenfity members that are present and interact (directly or indirectly, only going through
+  // other present species) with at least one other present species
+  presence_summary.present_with_interaction_path = FindPresentWithInteractionPath(
+    community_structure,
+    present
+  );
+
+  // Identify number of complete and partial subcommunities present
+  presence_summary.proportion_subcommunity_present.resize(community_structure.GetNumSubCommunities(), 0.0);
+  // const size_t num_present = present_species_ids.size();
+  const auto& subcomm_fingerprints = community_structure.GetFingerprints();
+  for (size_t comm_id = 0; comm_id < community_structure.GetNumSubCommunities(); ++comm_id) {
+    const auto& subcomm_fingerprint = subcomm_fingerprints[comm_id];
+    const emp::BitVector result = present & subcomm_fingerprint;
+    const size_t shared_overlap = result.CountOnes();
+    if (shared_overlap > 0) {
+      presence_summary.partial_subcommunities_present.emplace_back(comm_id);
+    }
+    // shared_overlap can't be larger than subcommunity size or number of present species
+    emp_assert(shared_overlap <= community_structure.GetNumMembers(comm_id));
+    emp_assert(shared_overlap <= presence_summary.present_species_ids.size());
+    if (shared_overlap == community_structure.GetNumMembers(comm_id)) {
+      presence_summary.complete_subcommunities_present.emplace_back(comm_id);
+    }
+    presence_summary.proportion_subcommunity_present[comm_id] = (double)shared_overlap / (double)community_structure.GetNumMembers(comm_id);
+  }
+
+  return presence_summary;
+}
+
+// Get (shared) presence summary for given presence pattern, using (and filling) cache if one is given
+inline presence_summary_ptr_t GetPresenceSummary(
+  const CommunityStructure& community_structure,
+  const emp::BitVector& present,
+  emp::Ptr<PresenceSummaryCache> presence_cache
+) {
+  presence_summary_ptr_t presence_summary = (presence_cache != nullptr) ? presence_cache->Get(present) : nullptr;
+  if (presence_summary == nullptr) {
+    presence_summary = std::make_shared<const PresenceSummary>(SummarizePresence(community_structure, present));
+    if (presence_cache != nullptr) presence_summary = presence_cache->Add(presence_summary);
+  }
+  return presence_summary;
+}
+
 // Generates instances of RecordedCommunitySummary from vectors of species counts
 //  At the moment summarizer forces configuration on construction ==> this helps to
 //  make sure that all summaries generated by a particular instance of a summarizer
@@ -96,6 +325,7 @@ protected:
   const CommunityStructure& community_structure;
   is_present_fun_t is_present_fun;
   emp::vector<summary_update_fun_t> summary_update_functions;
+  emp::Ptr<PresenceSummaryCache> presence_cache = nullptr; // Unowned (optional)
 
 public:
   RecordedCommunitySummarizer(
@@ -108,19 +338,30 @@ public:
     summary_update_functions(update_funs)
   { }
 
+  // Share a cache of presence summaries (summarizers sharing a cache must use the same
+  // community structure). Pass nullptr to stop using a cache.
+  void SetPresenceCache(emp::Ptr<PresenceSummaryCache> cache) {
+    presence_cache = cache;
+  }
+
+  // Summarize everything that only depends on which species are present
+  PresenceSummary SummarizePresence(const emp::BitVector& present) const {
+    return chemical_ecology::SummarizePresence(community_structure, present);
+  }
+
+  // Summarize each cell (on up to num_threads threads). Summaries are returned in cell order.
   emp::vector<RecordedCommunitySummary> SummarizeAll(
     const emp::vector<emp::vector<double>>& cells,
-    bool apply_update_functions=true
+    bool apply_update_functions=true,
+    size_t num_threads=1
   ) const {
-    emp::vector<RecordedCommunitySummary> summaries;
-    for (size_t i = 0; i < cells.size(); ++i) {
-      summaries.emplace_back(
-        Summarize(
-          cells[i],
-          apply_update_functions
-        )
+    emp::vector<RecordedCommunitySummary> summaries(cells.size());
+    utils::ParallelFor(0, cells.size(), num_threads, [&](size_t i) {
+      summaries[i] = Summarize(
+        cells[i],
+        apply_update_functions
       );
-    }
+    });
     return summaries;
   }
 
@@ -135,68 +376,15 @@ public:
     emp_assert(summary.counts.size() == member_counts.size());
 
     // Process counts
+    emp::BitVector present(num_members);
     for (size_t mem_i = 0; mem_i < num_members; ++mem_i) {
       summary.counts[mem_i] = member_counts[mem_i];
       // Fingerprint present/absence
-      summary.present[mem_i] = is_present_fun(summary.counts[mem_i]);
-      if (summary.present[mem_i]) {
-        summary.present_species_ids.emplace_back(mem_i);
-      }
+      present[mem_i] = is_present_fun(summary.counts[mem_i]);
     }
 
-    // Identify members that are present with no other members of their subcommunity
-    for (size_t mem_i : summary.present_species_ids) {
-      emp_assert(summary.present[mem_i]);
-      const size_t member_comm_id = community_structure.GetSubCommunityID(mem_i);
-      const auto& subcommunity = community_structure.GetSubCommunityPresent(member_comm_id);
-      emp_assert(subcommunity[mem_i]);
-      // Does this member species have other species present that share a community?
-      // I.e., are there more than one species of this subcommunity present?
-      const size_t num_subcomm_present = (summary.present & subcommunity).CountOnes();
-      summary.present_with_other_subcommunity_members[mem_i] = num_subcomm_present > 1;
-    }
-
-    // Idenfity members that are present but do not interact (directly or indirectly) with any other members of their subcommunity
-    // NOTE: could probably speed this up a little by finding connected components on reduced interaction matrix that includes only present species
-    for (size_t species_id : summary.present_species_ids) {
-      emp_assert(summary.present[species_id]);
-      const size_t community_id = community_structure.GetSubCommunityID(species_id);
-      // We can limit our search to this species' subcommunity
-      const auto& subcommunity = community_structure.GetSubCommunity(community_id);
-      bool has_path = false;
-      // // is there a path from species_id to each other present species, only going through other present species?
-      for (size_t other_id : subcommunity) {
-        // direct interactions only
-        has_path = PathExists(
-          community_structure,
-          species_id,
-          other_id,
-          summary.present
-        );
-        if (has_path) break;
-      }
-      summary.present_with_interaction_path[species_id] = has_path;
-    }
-
-    // Identify number of complete and partial subcommunities present
-    summary.proportion_subcommunity_present.resize(community_structure.GetNumSubCommunities(), 0.0);
-    // const size_t num_present = present_species_ids.size();
-    const auto& subcomm_fingerprints = community_structure.GetFingerprints();
-    for (size_t comm_id = 0; comm_id < community_structure.GetNumSubCommunities(); ++comm_id) {
-      const auto& subcomm_fingerprint = subcomm_fingerprints[comm_id];
-      const emp::BitVector result = summary.present & subcomm_fingerprint;
-      const size_t shared_overlap = result.CountOnes();
-      if (shared_overlap > 0) {
-        summary.partial_subcommunities_present.emplace_back(comm_id);
-      }
-      // shared_overlap can't be larger than subcommunity size or number of present species
-      emp_assert(shared_overlap <= community_structure.GetNumMembers(comm_id));
-      emp_assert(shared_overlap <= summary.present_species_ids.size());
-      if (shared_overlap == community_structure.GetNumMembers(comm_id)) {
-        summary.complete_subcommunities_present.emplace_back(comm_id);
-      }
-      summary.proportion_subcommunity_present[comm_id] = (double)shared_overlap / (double)community_structure.GetNumMembers(comm_id);
-    }
+    // Fill in everything that only depends on which species are present
+    summary.presence = GetPresenceSummary(community_structure, present, presence_cache);
 
     // Apply any summary update functions in sequential order
     if (apply_update_functions) {
@@ -215,7 +403,7 @@ public:
 //   const RecordedCommunitySummary& in_summary
 // ) {
 //   // Create new counts vector from given counts. Zero out all present no interaction species.
-//   emp::vector<double> new_counts(in_summary.counts);
+//   emp::vector<double> new_counts(in_summary.counts.begin(), in_summary.counts.end());
 //   for (size_t species_i = 0; species_i < new_counts.size(); ++species_i) {
 //     new_counts[species_i] = (in_summary.present_no_interactions[species_i]) ? 0 : new_counts[species_i];
 //   }
@@ -227,11 +415,86 @@ RecordedCommunitySummary KeepPresentWithInteractionPath(
   const RecordedCommunitySummary& in_summary
 ) {
   // Create new counts vector from given counts. Zero out all present no interaction species.
-  emp::vector<double> new_counts(in_summary.counts);
+  emp::vector<double> new_counts(in_summary.counts.begin(), in_summary.counts.end());
   for (size_t species_i = 0; species_i < new_counts.size(); ++species_i) {
-    new_counts[species_i] = (in_summary.present_with_interaction_path[species_i]) ? new_counts[species_i] : 0;
+    new_counts[species_i] = (in_summary.presence->present_with_interaction_path[species_i]) ? new_counts[species_i] : 0;
   }
   return summarizer.Summarize(new_counts, false);
 }
 
+// Summarizes a community several ways in a single pass: raw counts, counts of only the species
+// present with a valid interaction path (pwip), and dominance rankings. Presence information is
+// shared between the summaries: pwip summaries are derived from the raw summary by filtering it
+// in place (no second pass over the community), and every species is present in a ranked
+// community, so all ranked summaries share one precomputed presence summary.
+// Summarize functions are const and may be called concurrently.
+class RecordedCommunitySummarizerGroup {
+protected:
+  const CommunityStructure& community_structure;
+  double presence_threshold;                               // Species with counts at or above threshold are present
+  emp::Ptr<PresenceSummaryCache> presence_cache = nullptr; // Unowned (optional)
+  presence_summary_ptr_t all_present_summary;              // Every species present (for ranked communities)
+
+public:
+  RecordedCommunitySummarizerGroup(
+    const CommunityStructure& structure,
+    double threshold=1.0
+  ) :
+    community_structure(structure),
+    presence_threshold(threshold),
+    all_present_summary(std::make_shared<const PresenceSummary>(
+      SummarizePresence(structure, emp::BitVector(structure.GetNumSpecies(), true))
+    ))
+  { }
+
+  // Share a cache of presence summaries (see RecordedCommunitySummarizer::SetPresenceCache)
+  void SetPresenceCache(emp::Ptr<PresenceSummaryCache> cache) {
+    presence_cache = cache;
+  }
+
+  // Summarize species counts (raw) and the species among them present with a valid
+  // interaction path (pwip). Equivalent to summarizing with a count >= threshold summarizer,
+  // and with one that also applies KeepPresentWithInteractionPath.
+  void SummarizeCounts(
+    const emp::vector<double>& member_counts,
+    RecordedCommunitySummary& raw,
+    RecordedCommunitySummary& pwip
+  ) const {
+    // Scratch space (per-thread so summaries can be made concurrently)
+    thread_local emp::BitVector present;
+    const size_t num_members = member_counts.size();
+    raw.Reset(num_members);
+    present.Resize(num_members);
+    for (size_t mem_i = 0; mem_i < num_members; ++mem_i) {
+      raw.counts[mem_i] = member_counts[mem_i];
+      present[mem_i] = member_counts[mem_i] >= presence_threshold;
+    }
+    raw.presence = GetPresenceSummary(community_structure, present, presence_cache);
+
+    // Filter the raw summary down to species present with an interaction path
+    const emp::BitVector& pwip_present = raw.presence->present_with_interaction_path;
+    pwip.counts = raw.counts;
+    pwip.ranks.clear();
+    for (size_t mem_i = 0; mem_i < num_members; ++mem_i) {
+      if (!pwip_present[mem_i]) pwip.counts[mem_i] = 0;
+    }
+    // If nothing was filtered out, pwip summary shares the raw summary's presence information
+    pwip.presence = (pwip_present == raw.presence->present) ?
+      raw.presence :
+      GetPresenceSummary(community_structure, pwip_present, presence_cache);
+  }
+
+  // Summarize species dominance ranks. Ranked summaries only keep ranks (counts are left
+  // empty); output reports ranks as counts (see RecordedCommunitySummary::GetReportedCounts).
+  void SummarizeRanks(
+    const emp::vector<rank_t>& member_ranks,
+    RecordedCommunitySummary& ranked
+  ) const {
+    emp_assert(member_ranks.size() == all_present_summary->present.GetSize());
+    ranked.counts.clear();
+    ranked.ranks.assign(member_ranks.begin(), member_ranks.end());
+    ranked.presence = all_present_summary;
+  }
+}; // End RecordedCommunitySummarizerGroup definition
+
 } // End chemical_ecology namespace
\ No newline at end of file
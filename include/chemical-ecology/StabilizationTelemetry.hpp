@@ -0,0 +1,146 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <algorithm>
+
+#include "emp/base/vector.hpp"
+#include "emp/tools/string_utils.hpp"
+
+#include "chemical-ecology/utils/serialization_utils.hpp"
+
+// This file defines:
+// - StabilizationStats: per-cell stabilization update counts and convergence tallies
+//   gathered while stabilizing a world (or merged across many stabilizations)
+
+namespace chemical_ecology {
+
+// Tracks how much work cell stabilization took.
+// Update counts are binned into a log2 histogram: bin 0 holds cells that needed 0 updates,
+// bin b holds cells that needed [2^(b-1), 2^b) updates.
+struct StabilizationStats {
+  size_t num_cells = 0;                         // Number of cells stabilized
+  size_t num_calls = 0;                         // Number of stabilizations merged into these stats
+  size_t total_updates = 0;                     // Total growth updates run across all cells
+  size_t max_cell_updates = 0;                  // Most updates needed by a single cell
+  size_t num_not_converged = 0;                 // Number of cells that hit the update limit
+  double seconds = 0.0;                         // Wall time spent analyzing (stabilizing and summarizing) cells, summed over threads
+  emp::vector<size_t> update_histogram;         // Number of cells in each (log2) update-count bin
+  emp::vector<size_t> not_converged_positions;  // Positions of cells that hit the update limit
+  emp::vector<size_t> cell_updates;             // Updates needed by each cell (in stabilization order)
+
+  void Clear() {
+    num_cells = 0;
+    num_calls = 0;
+    total_updates = 0;
+    max_cell_updates = 0;
+    num_not_converged = 0;
+    seconds = 0.0;
+    update_histogram.clear();
+    not_converged_positions.clear();
+    cell_updates.clear();
+  }
+
+  static size_t GetHistogramBin(size_t updates) {
+    size_t bin = 0;
+    while (updates > 0) {
+      updates >>= 1;
+      ++bin;
+    }
+    return bin;
+  }
+
+  // Record the result of stabilizing the cell at the given position
+  void RecordCell(size_t pos, size_t updates, bool converged) {
+    ++num_cells;
+    total_updates += updates;
+    max_cell_updates = std::max(max_cell_updates, updates);
+    const size_t bin = GetHistogramBin(updates);
+    if (bin >= update_histogram.size()) update_histogram.resize(bin + 1, 0);
+    ++update_histogram[bin];
+    if (!converged) {
+      ++num_not_converged;
+      not_converged_positions.emplace_back(pos);
+    }
+    cell_updates.emplace_back(updates);
+  }
+
+  // Fold another set of stats into this one (per-cell details and positions are not kept)
+  void Merge(const StabilizationStats& other) {
+    num_cells += other.num_cells;
+    num_calls += std::max<size_t>(other.num_calls, 1);
+    total_updates += other.total_updates;
+    max_cell_updates = std::max(max_cell_updates, other.max_cell_updates);
+    seconds += other.seconds;
+    if (other.update_histogram.size() > update_histogram.size()) {
+      update_histogram.resize(other.update_histogram.size(), 0);
+    }
+    for (size_t i = 0; i < other.update_histogram.size(); ++i) {
+      update_histogram[i] += other.update_histogram[i];
+    }
+    num_not_converged += other.num_not_converged;
+  }
+
+  // Add another set of per-cell stats recorded after this one's cells (e.g., cells analyzed
+  // concurrently in chunks), keeping per-cell details and positions. Seconds are summed.
+  void Append(const StabilizationStats& other) {
+    num_cells += other.num_cells;
+    total_updates += other.total_updates;
+    max_cell_updates = std::max(max_cell_updates, other.max_cell_updates);
+    seconds += other.seconds;
+    if (other.update_histogram.size() > update_histogram.size()) {
+      update_histogram.resize(other.update_histogram.size(), 0);
+    }
+    for (size_t i = 0; i < other.update_histogram.size(); ++i) {
+      update_histogram[i] += other.update_histogram[i];
+    }
+    num_not_converged += other.num_not_converged;
+    not_converged_positions.insert(not_converged_positions.end(), other.not_converged_positions.begin(), other.not_converged_positions.end());
+    cell_updates.insert(cell_updates.end(), other.cell_updates.begin(), other.cell_updates.end());
+  }
+
+  double GetMeanUpdates() const {
+    return (num_cells > 0) ? (double)total_updates / (double)num_cells : 0.0;
+  }
+
+  // Write stats in a binary format (readable by Deserialize)
+  void Serialize(std::ostream& os) const {
+    utils::WriteBinary(os, (uint64_t)num_cells);
+    utils::WriteBinary(os, (uint64_t)num_calls);
+    utils::WriteBinary(os, (uint64_t)total_updates);
+    utils::WriteBinary(os, (uint64_t)max_cell_updates);
+    utils::WriteBinary(os, (uint64_t)num_not_converged);
+    utils::WriteBinary(os, seconds);
+    utils::WriteBinary(os, update_histogram);
+    utils::WriteBinary(os, not_converged_positions);
+    utils::WriteBinary(os, cell_updates);
+  }
+
+  // Read stats written by Serialize. Returns false if stream did not contain full stats.
+  bool Deserialize(std::istream& is) {
+    uint64_t values[5];
+    for (uint64_t& value : values) {
+      if (!utils::ReadBinary(is, value)) return false;
+    }
+    num_cells = values[0];
+    num_calls = values[1];
+    total_updates = values[2];
+    max_cell_updates = values[3];
+    num_not_converged = values[4];
+    return utils::ReadBinary(is, seconds)
+      && utils::ReadBinary(is, update_histogram)
+      && utils::ReadBinary(is, not_converged_positions)
+      && utils::ReadBinary(is, cell_updates);
+  }
+
+  // "Pretty" print the stats in a human-readable format
+  void Print(std::ostream & os=std::cout, const std::string& prefix = "") const {
+    os << prefix << "Cells stabilized: " << num_cells << " (" << num_calls << " stabilizations)" << std::endl;
+    os << prefix << "Updates per cell: mean " << GetMeanUpdates() << ", max " << max_cell_updates << std::endl;
+    os << prefix << "Cells that did not converge: " << num_not_converged << std::endl;
+    os << prefix << "Update histogram (log2 bins): " << emp::to_string(update_histogram) << std::endl;
+    os << prefix << "Time spent analyzing cells: " << seconds << "s" << std::endl;
+  }
+};
+
+} // End chemical_ecology namespace
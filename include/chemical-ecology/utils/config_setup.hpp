@@ -1,6 +1,7 @@
 #pragma once
 
 #include <filesystem>
+#include <optional>
 
 #include "emp/config/ArgManager.hpp"
 #include "chemical-ecology/Config.hpp"
@@ -17,10 +18,22 @@ void use_existing_config_file(chemical_ecology::Config & config, emp::ArgManager
     std::exit(EXIT_FAILURE);
 }
 
-void setup_config_native(chemical_ecology::Config & config, int argc, char* argv[]) {
+// Returns true if the run should resume from its latest checkpoint (--resume)
+bool setup_config_native(chemical_ecology::Config & config, int argc, char* argv[]) {
+  bool resume = false;
   auto specs = emp::ArgManager::make_builtin_specs(&config);
+  specs.emplace(
+    "resume",
+    emp::ArgSpec(
+      0,
+      "Resume from the latest checkpoint in OUTPUT_DIR (see CHECKPOINT_INTERVAL)",
+      {},
+      [&resume](std::optional<emp::vector<std::string>> arg) { if (arg) resume = true; }
+    )
+  );
   emp::ArgManager am(argc, argv, specs);
   use_existing_config_file(config, am);
+  return resume;
 }
 
 } // End of chemical_ecology::utils namespace
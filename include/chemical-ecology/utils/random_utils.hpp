@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+
+#include "emp/math/Random.hpp"
+
+#include "chemical-ecology/utils/serialization_utils.hpp"
+
+namespace chemical_ecology::utils {
+
+// emp::Random whose generator state can be written out and read back (e.g., in a
+// checkpoint), so a restored generator continues exactly where the saved one left off.
+class SerializableRandom : public emp::Random {
+public:
+  using emp::Random::Random;
+
+  void Serialize(std::ostream& os) const {
+    WriteBinary(os, original_seed);
+    WriteBinary(os, value);
+    WriteBinary(os, weyl_state);
+    WriteBinary(os, expRV);
+  }
+
+  bool Deserialize(std::istream& is) {
+    return ReadBinary(is, original_seed)
+      && ReadBinary(is, value)
+      && ReadBinary(is, weyl_state)
+      && ReadBinary(is, expRV);
+  }
+};
+
+} // End chemical_ecology::utils namespace
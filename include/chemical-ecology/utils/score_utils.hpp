@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+
+namespace chemical_ecology::utils {
+
+// Number of times a world community's logged assembly/adaptive proportions are added into
+// the logged multiplicative score: once per 0.01 step taken from 0 while below world_prop.
+// The steps are accumulated in floating point (as the score has always done), so the count
+// can differ from ceil(world_prop / 0.01) (e.g., 0.07 gives 7 and 0.1 gives 11).
+inline size_t CountLoggedScoreTerms(double world_prop) {
+  size_t num_terms = 0;
+  for (double j = 0.0; j < world_prop; j += .01) ++num_terms;
+  return num_terms;
+}
+
+} // End chemical_ecology::utils namespace
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+#include "emp/base/vector.hpp"
+#include "emp/bits/BitVector.hpp"
+
+#include "chemical-ecology/utils/small_vector.hpp"
+
+// Minimal helpers for reading/writing binary data (e.g., cached recorded community sets).
+// Values are written in native byte order, so files are meant to be read back on the
+// same kind of machine that wrote them.
+// Read functions return false if the stream runs out (or fails) before the value is read.
+
+namespace chemical_ecology::utils {
+
+template<typename T>
+void WriteBinary(std::ostream& os, const T& value) {
+  static_assert(std::is_trivially_copyable<T>::value, "WriteBinary requires a trivially copyable type");
+  os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool ReadBinary(std::istream& is, T& value) {
+  static_assert(std::is_trivially_copyable<T>::value, "ReadBinary requires a trivially copyable type");
+  is.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return (bool)is;
+}
+
+template<typename T>
+void WriteBinary(std::ostream& os, const emp::vector<T>& values) {
+  WriteBinary(os, (uint64_t)values.size());
+  for (const auto& value : values) WriteBinary(os, value);
+}
+
+template<typename T>
+bool ReadBinary(std::istream& is, emp::vector<T>& values) {
+  uint64_t size = 0;
+  if (!ReadBinary(is, size)) return false;
+  values.clear();
+  for (uint64_t i = 0; i < size; ++i) {
+    T value;
+    if (!ReadBinary(is, value)) return false;
+    values.emplace_back(value);
+  }
+  return true;
+}
+
+// Same layout as emp::vector
+template<typename T, size_t INLINE_CAPACITY>
+void WriteBinary(std::ostream& os, const SmallVector<T, INLINE_CAPACITY>& values) {
+  WriteBinary(os, (uint64_t)values.size());
+  for (const auto& value : values) WriteBinary(os, value);
+}
+
+template<typename T, size_t INLINE_CAPACITY>
+bool ReadBinary(std::istream& is, SmallVector<T, INLINE_CAPACITY>& values) {
+  // Read through a vector, so a bad size can't make us allocate more than the stream holds
+  emp::vector<T> read_values;
+  if (!ReadBinary(is, read_values)) return false;
+  values.assign(read_values.begin(), read_values.end());
+  return true;
+}
+
+inline void WriteBinary(std::ostream& os, const std::string& str) {
+  WriteBinary(os, (uint64_t)str.size());
+  os.write(str.data(), str.size());
+}
+
+inline bool ReadBinary(std::istream& is, std::string& str) {
+  uint64_t size = 0;
+  if (!ReadBinary(is, size)) return false;
+  str.clear();
+  for (uint64_t i = 0; i < size; ++i) {
+    char c;
+    if (!is.get(c)) return false;
+    str.push_back(c);
+  }
+  return true;
+}
+
+// Bits are packed 8 per byte
+inline void WriteBinary(std::ostream& os, const emp::BitVector& bits) {
+  const size_t num_bits = bits.GetSize();
+  WriteBinary(os, (uint64_t)num_bits);
+  for (size_t byte_start = 0; byte_start < num_bits; byte_start += 8) {
+    uint8_t byte = 0;
+    for (size_t i = byte_start; i < num_bits && i < byte_start + 8; ++i) {
+      byte |= (uint8_t)((uint8_t)bits.Get(i) << (i - byte_start));
+    }
+    WriteBinary(os, byte);
+  }
+}
+
+inline bool ReadBinary(std::istream& is, emp::BitVector& bits) {
+  uint64_t num_bits = 0;
+  if (!ReadBinary(is, num_bits)) return false;
+  bits.Resize(num_bits);
+  bits.Clear();
+  for (size_t byte_start = 0; byte_start < num_bits; byte_start += 8) {
+    uint8_t byte = 0;
+    if (!ReadBinary(is, byte)) return false;
+    for (size_t i = byte_start; i < num_bits && i < byte_start + 8; ++i) {
+      bits.Set(i, (byte >> (i - byte_start)) & 1);
+    }
+  }
+  return true;
+}
+
+// 64-bit FNV-1a hash, built up incrementally from the bytes of each value added
+class Hasher {
+protected:
+  uint64_t hash = 0xcbf29ce484222325ULL;
+
+public:
+  void AddBytes(const void* data, size_t num_bytes) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < num_bytes; ++i) {
+      hash ^= bytes[i];
+      hash *= 0x100000001b3ULL;
+    }
+  }
+
+  template<typename T>
+  void Add(const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "Hasher::Add requires a trivially copyable type");
+    AddBytes(&value, sizeof(T));
+  }
+
+  template<typename T>
+  void Add(const emp::vector<T>& values) {
+    Add((uint64_t)values.size());
+    for (const auto& value : values) Add(value);
+  }
+
+  void Add(const std::string& str) {
+    Add((uint64_t)str.size());
+    AddBytes(str.data(), str.size());
+  }
+
+  uint64_t GetHash() const { return hash; }
+};
+
+} // End chemical_ecology::utils namespace
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "emp/base/assert.hpp"
+
+// Vector of trivially copyable values that keeps up to INLINE_CAPACITY values inside the
+// object itself (no heap allocation), spilling over to a heap array only for longer
+// vectors. Meant for the many short, fixed-length vectors stored per recorded community
+// (e.g., species counts), where a heap allocation per vector dominates memory use.
+// Only supports what those vectors need: sizing, element access, iteration, and comparison.
+
+namespace chemical_ecology::utils {
+
+template<typename T, size_t INLINE_CAPACITY>
+class SmallVector {
+  static_assert(std::is_trivially_copyable<T>::value, "SmallVector requires a trivially copyable type");
+
+protected:
+  std::unique_ptr<T[]> heap_values;  // Only allocated if size exceeds INLINE_CAPACITY
+  uint32_t num_values = 0;
+  T inline_values[INLINE_CAPACITY];
+
+  // Make room for exactly new_size values (existing values are not kept)
+  void Reallocate(size_t new_size) {
+    if (new_size > INLINE_CAPACITY) {
+      heap_values = std::make_unique<T[]>(new_size);
+    } else {
+      heap_values.reset();
+    }
+    num_values = (uint32_t)new_size;
+  }
+
+public:
+  using value_type = T;
+  using iterator = T*;
+  using const_iterator = const T*;
+
+  SmallVector() = default;
+
+  SmallVector(size_t size, const T& value=T()) { assign(size, value); }
+
+  template<typename IT>
+  SmallVector(IT first, IT last) { assign(first, last); }
+
+  SmallVector(const SmallVector& other) { assign(other.begin(), other.end()); }
+
+  SmallVector(SmallVector&& other) noexcept :
+    heap_values(std::move(other.heap_values)),
+    num_values(other.num_values)
+  {
+    if (!heap_values) std::copy(other.inline_values, other.inline_values + num_values, inline_values);
+    other.num_values = 0;
+  }
+
+  SmallVector& operator=(const SmallVector& other) {
+    if (this != &other) assign(other.begin(), other.end());
+    return *this;
+  }
+
+  SmallVector& operator=(SmallVector&& other) noexcept {
+    if (this == &other) return *this;
+    heap_values = std::move(other.heap_values);
+    num_values = other.num_values;
+    if (!heap_values) std::copy(other.inline_values, other.inline_values + num_values, inline_values);
+    other.num_values = 0;
+    return *this;
+  }
+
+  size_t size() const { return num_values; }
+  bool empty() const { return num_values == 0; }
+
+  T* data() { return heap_values ? heap_values.get() : inline_values; }
+  const T* data() const { return heap_values ? heap_values.get() : inline_values; }
+
+  iterator begin() { return data(); }
+  iterator end() { return data() + num_values; }
+  const_iterator begin() const { return data(); }
+  const_iterator end() const { return data() + num_values; }
+
+  T& operator[](size_t i) { emp_assert(i < num_values); return data()[i]; }
+  const T& operator[](size_t i) const { emp_assert(i < num_values); return data()[i]; }
+
+  void clear() { Reallocate(0); }
+
+  void assign(size_t size, const T& value) {
+    Reallocate(size);
+    std::fill(begin(), end(), value);
+  }
+
+  template<typename IT>
+  void assign(IT first, IT last) {
+    const size_t size = (size_t)std::distance(first, last);
+    if (size != num_values || size > INLINE_CAPACITY) Reallocate(size);
+    std::copy(first, last, begin());
+  }
+
+  // Resize, keeping existing values (new values are set to value)
+  void resize(size_t size, const T& value=T()) {
+    if (size == num_values) return;
+    const size_t num_kept = std::min(size, (size_t)num_values);
+    SmallVector resized(size, value);
+    std::copy(begin(), begin() + num_kept, resized.begin());
+    *this = std::move(resized);
+  }
+
+  bool operator==(const SmallVector& other) const {
+    return std::equal(begin(), end(), other.begin(), other.end());
+  }
+  bool operator!=(const SmallVector& other) const { return !(*this == other); }
+  bool operator<(const SmallVector& other) const {
+    return std::lexicographical_compare(begin(), end(), other.begin(), other.end());
+  }
+};
+
+} // End chemical_ecology::utils namespace
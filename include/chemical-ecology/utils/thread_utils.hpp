@@ -0,0 +1,57 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "emp/base/vector.hpp"
+
+namespace chemical_ecology::utils {
+
+// Number of worker threads to use given a requested thread count
+// (0 = one per available hardware thread).
+inline size_t GetNumThreads(size_t requested) {
+  if (requested > 0) return requested;
+  const size_t hardware_threads = std::thread::hardware_concurrency();
+  return (hardware_threads > 0) ? hardware_threads : 1;
+}
+
+// Calls fun(i) for every i in [begin, end) using up to num_threads threads.
+// Work is handed out one index at a time, so uneven workloads balance across threads.
+// fun must be safe to call concurrently for different indices. With one thread (or
+// only one index), everything runs on the calling thread.
+template<typename FUN>
+void ParallelFor(size_t begin, size_t end, size_t num_threads, FUN&& fun) {
+  if (end <= begin) return;
+  num_threads = std::min(GetNumThreads(num_threads), end - begin);
+  if (num_threads <= 1) {
+    for (size_t i = begin; i < end; ++i) fun(i);
+    return;
+  }
+
+  std::atomic<size_t> next_i(begin);
+  auto worker = [&next_i, end, &fun]() {
+    for (size_t i = next_i++; i < end; i = next_i++) fun(i);
+  };
+  emp::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (size_t t = 1; t < num_threads; ++t) threads.emplace_back(worker);
+  worker();
+  for (auto& thread : threads) thread.join();
+}
+
+// Derives a seed for an independent random number stream (e.g., one per replicate)
+// from a base seed. Seeds are always positive, as non-positive seeds are
+// interpreted by emp::Random as a request for a time-based seed.
+inline int GetStreamSeed(int base_seed, size_t stream_id) {
+  // splitmix64 finalizer
+  uint64_t z = ((uint64_t)(uint32_t)base_seed << 32) ^ (uint64_t)stream_id;
+  z += 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  z = z ^ (z >> 31);
+  return (int)(z & 0x7FFFFFFE) + 1;
+}
+
+} // End chemical_ecology::utils namespace
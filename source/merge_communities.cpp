@@ -0,0 +1,76 @@
+//  This file is part of Artificial Ecology for Chemical Ecology Project
+//  Copyright (C) Emily Dolson, 2021.
+//  Released under MIT license; see LICENSE
+
+#include <iostream>
+#include <fstream>
+#include <string>
+
+#include "emp/base/vector.hpp"
+
+#include "chemical-ecology/AEcoWorld.hpp"
+
+// Combines recorded community sets exported by separate runs (EXPORT_RECORDED_COMMUNITIES),
+// e.g., runs with different seeds or replicates spread across machines.
+// Usage: merge_communities OUTPUT_FILE INPUT_FILE [INPUT_FILE ...]
+// Inputs are merged in the order given (community counts for matching communities are
+// summed), so merging the same inputs in the same order always gives the same output.
+
+using export_t = chemical_ecology::AEcoWorld::RecordedCommunityExport;
+
+void PrintSets(
+  const std::string& name,
+  const chemical_ecology::AEcoWorld::RecordedCommunitySets& sets
+) {
+  std::cout << "  " << name << ": "
+    << sets.raw.GetSize() << " raw, "
+    << sets.pwip.GetSize() << " pwip, "
+    << sets.ranked.GetSize() << " ranked, "
+    << sets.ranked_threshold.GetSize() << " ranked (threshold) communities from "
+    << sets.raw.GetTotalCount() << " recorded"
+    << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc < 3) {
+    std::cout << "Usage: " << argv[0] << " OUTPUT_FILE INPUT_FILE [INPUT_FILE ...]" << std::endl;
+    return 1;
+  }
+
+  export_t merged;
+  for (int arg_i = 2; arg_i < argc; ++arg_i) {
+    const std::string path(argv[arg_i]);
+    std::ifstream input_file(path, std::ios::binary);
+    export_t communities;
+    if (!input_file || !communities.Deserialize(input_file)) {
+      std::cout << "Unable to read recorded communities file: " << path << std::endl;
+      std::cout << "Exiting." << std::endl;
+      exit(-1);
+    }
+    if (arg_i == 2) {
+      merged = std::move(communities);
+    } else if (!merged.IsCompatible(communities)) {
+      std::cout << "Recorded communities file " << path << " comes from a different interaction matrix than " << argv[2] << std::endl;
+      std::cout << "Exiting." << std::endl;
+      exit(-1);
+    } else {
+      merged.Merge(communities);
+    }
+  }
+
+  const std::string output_path(argv[1]);
+  std::ofstream output_file(output_path, std::ios::binary);
+  merged.Serialize(output_file);
+  if (!output_file) {
+    std::cout << "Failed to write recorded communities file: " << output_path << std::endl;
+    std::cout << "Exiting." << std::endl;
+    exit(-1);
+  }
+
+  std::cout << "Merged " << merged.num_runs << " runs into " << output_path << std::endl;
+  PrintSets("assembly", merged.assembly);
+  PrintSets("adaptive", merged.adaptive);
+  PrintSets("world", merged.world);
+  return 0;
+}
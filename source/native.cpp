@@ -17,13 +17,13 @@ chemical_ecology::Config cfg;
 int main(int argc, char* argv[])
 {
   // Set up a configuration panel for native application
-  chemical_ecology::utils::setup_config_native(cfg, argc, argv);
+  const bool resume = chemical_ecology::utils::setup_config_native(cfg, argc, argv);
   if(cfg.V()){
     cfg.Write(std::cout);
   }
 
   chemical_ecology::AEcoWorld world;
-  world.Setup(cfg);
+  world.Setup(cfg, resume);
   world.Run();
 
   return 0;
@@ -0,0 +1,73 @@
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include <cmath>
+#include <map>
+
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+
+#include "chemical-ecology/AssemblyStateGraph.hpp"
+
+using cell_t = chemical_ecology::AssemblyStateGraph::cell_t;
+
+// Stable state only depends on which species are present (so one representative per
+// presence state is exact): species 0 excludes species 1, species 2 only persists with
+// species 3, and each remaining species settles at 10 * (id + 1).
+void StabilizeByPresence(cell_t& cell) {
+  if (cell[0] > 0) cell[1] = 0;
+  if (!(cell[3] > 0)) cell[2] = 0;
+  for (size_t i = 0; i < cell.size(); ++i) {
+    if (cell[i] > 0) cell[i] = 10.0 * (double)(i + 1);
+  }
+}
+
+TEST_CASE("AssemblyStateGraph should match a simulation of seeding and stabilization") {
+  const size_t num_species = 4;
+  const double seed_prob = 0.2;
+  const double max_pop = 100;
+  chemical_ecology::AssemblyStateGraph graph;
+  graph.Build(num_species, seed_prob, max_pop, StabilizeByPresence);
+  // Every combination of species that can coexist is reachable
+  REQUIRE(graph.GetNumStates() == 9);
+  REQUIRE(graph.GetNumCommunities() == 9);
+
+  const emp::vector<double> empty_dist = graph.GetCommunityDistribution(0);
+  REQUIRE(empty_dist[0] == 1.0);
+  REQUIRE(graph.GetCommunity(0) == cell_t(num_species, 0.0));
+
+  // Simulate the assembly process: each step, every species seeds in (adding one individual)
+  // with probability seed_prob, then the community stabilizes
+  emp::Random random(6);
+  const size_t num_trials = 20000;
+  for (size_t num_steps : {1, 3, 8}) {
+    std::map<cell_t, size_t> community_counts;
+    for (size_t trial = 0; trial < num_trials; ++trial) {
+      cell_t cell(num_species, 0.0);
+      StabilizeByPresence(cell);
+      for (size_t step = 0; step < num_steps; ++step) {
+        for (double& count : cell) {
+          if (random.P(seed_prob)) count = std::min(count + 1, max_pop);
+        }
+        StabilizeByPresence(cell);
+      }
+      ++community_counts[cell];
+    }
+
+    const emp::vector<double> community_dist = graph.GetCommunityDistribution(num_steps);
+    double total_prob = 0.0;
+    size_t num_found = 0;
+    for (size_t community_id = 0; community_id < graph.GetNumCommunities(); ++community_id) {
+      const size_t sim_count = community_counts[graph.GetCommunity(community_id)];
+      const double sim_prob = (double)sim_count / (double)num_trials;
+      // Over 6 standard deviations for any probability
+      REQUIRE(std::abs(community_dist[community_id] - sim_prob) < 0.025);
+      total_prob += community_dist[community_id];
+      num_found += sim_count;
+    }
+    REQUIRE(std::abs(total_prob - 1.0) < 1e-9);
+    // Simulation never finds a community that is not in the graph
+    REQUIRE(num_found == num_trials);
+  }
+}
@@ -197,4 +197,99 @@ TEST_CASE("Verify structure for misc loaded matrices") {
   SECTION("data/newPOC.dat") {
     VerifyStructure("data/newPOC.dat");
   }
-}
\ No newline at end of file
+}
+
+// Compares FindPresentWithInteractionPath with pairwise path searches over random sets of
+// present species
+void VerifyPresentWithInteractionPath(const chemical_ecology::CommunityStructure& comm_struct) {
+  const size_t num_species = comm_struct.GetNumSpecies();
+
+  emp::Random random(2);
+  for (size_t trial = 0; trial < 100; ++trial) {
+    // Vary how many species are present from trial to trial
+    const double prob_present = (double)(trial % 10) / 9.0;
+    emp::BitVector present(num_species);
+    for (size_t spec_id = 0; spec_id < num_species; ++spec_id) {
+      present[spec_id] = random.P(prob_present);
+    }
+    const emp::BitVector with_path = chemical_ecology::FindPresentWithInteractionPath(
+      comm_struct,
+      present
+    );
+    REQUIRE(with_path.GetSize() == num_species);
+    // Compare with pairwise path searches
+    for (size_t spec_id = 0; spec_id < num_species; ++spec_id) {
+      bool has_path = false;
+      for (size_t other_id = 0; other_id < num_species && !has_path; ++other_id) {
+        if (other_id == spec_id) continue;
+        has_path = chemical_ecology::PathExists(comm_struct, spec_id, other_id, present);
+      }
+      REQUIRE(with_path[spec_id] == has_path);
+    }
+  }
+}
+
+void VerifyPresentWithInteractionPath(const std::string& matrix_path) {
+  chemical_ecology::InteractionMatrix interaction_matrix(
+    interacts_fun
+  );
+  interaction_matrix.LoadInteractions(matrix_path);
+
+  chemical_ecology::CommunityStructure comm_struct(
+    interaction_matrix
+  );
+  REQUIRE(comm_struct.HasSymmetricInteractions());
+  VerifyPresentWithInteractionPath(comm_struct);
+}
+
+TEST_CASE("CommunityStructure should detect asymmetric interactions") {
+  // Species 0 reaches both others (so there is one subcommunity), but 2 does not reach 0
+  const emp::vector<emp::vector<double>> matrix = {{0, 1, 1}, {1, 0, 0}, {0, 1, 0}};
+  chemical_ecology::CommunityStructure one_way(
+    matrix,
+    [](const emp::vector<emp::vector<double>>& mat, size_t from, size_t to) -> bool {
+      return mat[from][to] != 0;
+    }
+  );
+  REQUIRE(!one_way.HasSymmetricInteractions());
+  chemical_ecology::CommunityStructure either_way(matrix, interacts_fun);
+  REQUIRE(either_way.HasSymmetricInteractions());
+}
+
+TEST_CASE("FindPresentWithInteractionPath should find present species connected to other present species") {
+  SECTION("data/403_matrix.dat") {
+    VerifyPresentWithInteractionPath("data/403_matrix.dat");
+  }
+  SECTION("data/class1.dat") {
+    VerifyPresentWithInteractionPath("data/class1.dat");
+  }
+  SECTION("data/class2.dat") {
+    VerifyPresentWithInteractionPath("data/class2.dat");
+  }
+  SECTION("data/class3.dat") {
+    VerifyPresentWithInteractionPath("data/class3.dat");
+  }
+  SECTION("data/class4.dat") {
+    VerifyPresentWithInteractionPath("data/class4.dat");
+  }
+  SECTION("asymmetric interactions") {
+    // One-way interactions: a ring (so there is one subcommunity) plus random extra edges
+    const size_t num_species = 12;
+    emp::Random random(3);
+    emp::vector<emp::vector<double>> matrix(num_species, emp::vector<double>(num_species, 0));
+    for (size_t spec_id = 0; spec_id < num_species; ++spec_id) {
+      matrix[spec_id][(spec_id + 1) % num_species] = 1;
+      for (size_t other_id = 0; other_id < num_species; ++other_id) {
+        if (other_id != spec_id && random.P(0.15)) matrix[spec_id][other_id] = 1;
+      }
+    }
+    chemical_ecology::CommunityStructure comm_struct(
+      matrix,
+      [](const emp::vector<emp::vector<double>>& mat, size_t from, size_t to) -> bool {
+        return mat[from][to] != 0;
+      }
+    );
+    REQUIRE(!comm_struct.HasSymmetricInteractions());
+    VerifyPresentWithInteractionPath(comm_struct);
+  }
+}
@@ -0,0 +1,356 @@
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include <limits>
+#include <map>
+#include <memory>
+#include <sstream>
+
+#include "chemical-ecology/RecordedCommunitySet.hpp"
+
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+
+using community_set_t = chemical_ecology::RecordedCommunitySet<chemical_ecology::summary_counts_t>;
+
+community_set_t::summary_key_fun_t counts_key_fun = [](
+  const chemical_ecology::RecordedCommunitySummary& summary
+) -> const auto& {
+  return summary.counts;
+};
+
+// Presence information is only needed to serialize summaries
+chemical_ecology::RecordedCommunitySummary MakeSummary(
+  const emp::vector<double>& counts,
+  bool with_presence=false
+) {
+  chemical_ecology::RecordedCommunitySummary summary;
+  summary.Reset(counts.size());
+  summary.counts.assign(counts.begin(), counts.end());
+  if (with_presence) {
+    auto presence = std::make_shared<chemical_ecology::PresenceSummary>();
+    presence->present.Resize(counts.size());
+    for (size_t i = 0; i < counts.size(); ++i) presence->present.Set(i, counts[i] > 0);
+    summary.presence = std::move(presence);
+  }
+  return summary;
+}
+
+// Checks that set contents match expected counts (keyed by summary counts)
+void VerifySet(
+  const community_set_t& community_set,
+  const std::map<emp::vector<double>, size_t>& expected
+) {
+  REQUIRE(community_set.GetSize() == expected.size());
+  size_t total_count = 0;
+  for (const auto& entry : expected) total_count += entry.second;
+  REQUIRE(community_set.GetTotalCount() == total_count);
+  for (size_t id = 0; id < community_set.GetSize(); ++id) {
+    const auto& summary = community_set.GetCommunitySummary(id);
+    const emp::vector<double> counts(summary.counts.begin(), summary.counts.end());
+    REQUIRE(expected.count(counts) == 1);
+    REQUIRE(community_set.GetCommunityCount(id) == expected.at(counts));
+    REQUIRE(community_set.GetCommunityID(summary) == std::optional<size_t>{id});
+  }
+}
+
+TEST_CASE("RecordedCommunitySet should identify summaries by key") {
+  community_set_t community_set(counts_key_fun);
+  REQUIRE(community_set.GetSize() == 0);
+  REQUIRE(!community_set.Has(MakeSummary({1, 2, 3})));
+
+  community_set.Add(MakeSummary({1, 2, 3}));
+  community_set.Add(MakeSummary({3, 2, 1}), 4);
+  community_set.Add(MakeSummary({1, 2, 3}));
+  REQUIRE(community_set.GetSize() == 2);
+  REQUIRE(community_set.GetCommunityID(MakeSummary({1, 2, 3})) == std::optional<size_t>{0});
+  REQUIRE(community_set.GetCommunityID(MakeSummary({3, 2, 1})) == std::optional<size_t>{1});
+  REQUIRE(community_set.GetCommunityCount(0) == 2);
+  REQUIRE(community_set.GetCommunityCount(1) == 4);
+  REQUIRE(!community_set.Has(MakeSummary({1, 2})));
+
+  // Negative zero counts compare equal to zero counts
+  community_set.Add(MakeSummary({0, 1}));
+  community_set.Add(MakeSummary({-0.0, 1}));
+  REQUIRE(community_set.GetSize() == 3);
+  REQUIRE(community_set.GetCommunityCount(2) == 2);
+
+  community_set.Remove(MakeSummary({1, 2, 3}));
+  REQUIRE(community_set.GetSize() == 2);
+  REQUIRE(!community_set.Has(MakeSummary({1, 2, 3})));
+  REQUIRE(community_set.Has(MakeSummary({3, 2, 1})));
+  REQUIRE(community_set.Has(MakeSummary({0, 1})));
+}
+
+TEST_CASE("RecordedCommunitySet should stay consistent through random adds and removes") {
+  emp::Random random(2);
+  community_set_t community_set(counts_key_fun);
+  std::map<emp::vector<double>, size_t> expected;
+
+  for (size_t step = 0; step < 20000; ++step) {
+    // Few distinct small values, so that keys are often repeated
+    emp::vector<double> counts(3);
+    for (auto& count : counts) count = (double)random.GetUInt(8);
+    const auto summary = MakeSummary(counts);
+    if (random.P(0.7)) {
+      const size_t count = 1 + random.GetUInt(3);
+      community_set.Add(summary, count);
+      expected[counts] += count;
+    } else if (expected.count(counts)) {
+      if (random.P(0.5)) {
+        community_set.Remove(summary);
+        expected.erase(counts);
+      } else {
+        const size_t remove_count = 1 + random.GetUInt(3);
+        community_set.Remove(summary, remove_count);
+        if (remove_count >= expected[counts]) {
+          expected.erase(counts);
+        } else {
+          expected[counts] -= remove_count;
+        }
+      }
+    } else {
+      REQUIRE(!community_set.Has(summary));
+    }
+    if (step % 500 == 0) VerifySet(community_set, expected);
+  }
+  VerifySet(community_set, expected);
+
+  community_set.Clear();
+  REQUIRE(community_set.GetSize() == 0);
+  REQUIRE(community_set.GetTotalCount() == 0);
+  REQUIRE(!community_set.Has(MakeSummary({0, 0, 0})));
+}
+
+TEST_CASE("Bounded RecordedCommunitySet should keep frequent communities with bounded count error") {
+  emp::Random random(3);
+  community_set_t community_set(counts_key_fun);
+  community_set.SetCapacity(10);
+  REQUIRE(community_set.GetCapacity() == 10);
+  std::map<emp::vector<double>, size_t> true_counts;
+
+  for (size_t step = 0; step < 20000; ++step) {
+    // A few frequent communities among many rare ones
+    emp::vector<double> counts(2);
+    if (random.P(0.5)) {
+      counts[0] = (double)random.GetUInt(3);
+    } else {
+      counts[0] = (double)(3 + random.GetUInt(2000));
+      counts[1] = (double)random.GetUInt(5);
+    }
+    community_set.Add(MakeSummary(counts, true));
+    ++true_counts[counts];
+    REQUIRE(community_set.GetSize() <= 10);
+  }
+  REQUIRE(community_set.GetTotalCount() == 20000);
+
+  // Frequent communities are kept, and kept counts are within their error of the true count
+  for (double frequent = 0; frequent < 3; ++frequent) {
+    REQUIRE(community_set.Has(MakeSummary({frequent, 0})));
+  }
+  size_t tracked_lower_bound = 0;
+  for (size_t id = 0; id < community_set.GetSize(); ++id) {
+    const auto& summary = community_set.GetCommunitySummary(id);
+    const size_t count = community_set.GetCommunityCount(id);
+    const size_t error = community_set.GetCountError(id);
+    const size_t true_count = true_counts[emp::vector<double>(summary.counts.begin(), summary.counts.end())];
+    REQUIRE(error <= count);
+    REQUIRE(true_count <= count);
+    REQUIRE(true_count + error >= count);
+    tracked_lower_bound += count - error;
+  }
+  REQUIRE(community_set.GetUntrackedCount() == 20000 - tracked_lower_bound);
+
+  // Round trip keeps counts, errors, and the sketch
+  std::stringstream stream;
+  community_set.Serialize(stream);
+  community_set_t loaded_set(counts_key_fun);
+  REQUIRE(loaded_set.Deserialize(stream));
+  REQUIRE(loaded_set.GetCapacity() == 10);
+  REQUIRE(loaded_set.GetSize() == community_set.GetSize());
+  REQUIRE(loaded_set.GetTotalCount() == community_set.GetTotalCount());
+  REQUIRE(loaded_set.GetCountErrorBound() == community_set.GetCountErrorBound());
+  for (size_t id = 0; id < community_set.GetSize(); ++id) {
+    const auto& summary = community_set.GetCommunitySummary(id);
+    REQUIRE(loaded_set.GetCommunityID(summary) == std::optional<size_t>{id});
+    REQUIRE(loaded_set.GetCommunityCount(id) == community_set.GetCommunityCount(id));
+    REQUIRE(loaded_set.GetCountError(id) == community_set.GetCountError(id));
+  }
+  const auto rare_summary = MakeSummary({1000, 1});
+  loaded_set.Add(rare_summary);
+  community_set.Add(rare_summary);
+  REQUIRE(loaded_set.Has(rare_summary) == community_set.Has(rare_summary));
+}
+
+TEST_CASE("Bounded RecordedCommunitySet should replace a least-counted community") {
+  emp::Random random(4);
+  community_set_t community_set(counts_key_fun);
+  community_set.SetCapacity(8);
+
+  for (size_t step = 0; step < 20000; ++step) {
+    emp::vector<double> counts(2);
+    counts[0] = (double)random.GetUInt(40);
+    const auto summary = MakeSummary(counts);
+    if (random.P(0.1) && community_set.Has(summary)) {
+      // Removes change counts (and IDs) of kept communities
+      if (random.P(0.5)) {
+        community_set.Remove(summary);
+      } else {
+        community_set.Remove(summary, 1 + random.GetUInt(3));
+      }
+      continue;
+    }
+    // Kept communities (and their counts) before adding
+    std::map<emp::vector<double>, size_t> kept;
+    size_t min_count = std::numeric_limits<size_t>::max();
+    for (size_t id = 0; id < community_set.GetSize(); ++id) {
+      const auto& kept_summary = community_set.GetCommunitySummary(id);
+      const size_t count = community_set.GetCommunityCount(id);
+      kept[emp::vector<double>(kept_summary.counts.begin(), kept_summary.counts.end())] = count;
+      min_count = std::min(min_count, count);
+    }
+    const bool was_kept = community_set.Has(summary);
+    community_set.Add(summary, 1 + random.GetUInt(3));
+    REQUIRE(community_set.GetSize() <= 8);
+    if (was_kept || !community_set.Has(summary) || kept.size() < 8) continue;
+    // New community replaced exactly one least-counted community
+    size_t num_replaced = 0;
+    for (const auto& entry : kept) {
+      if (community_set.Has(MakeSummary(entry.first))) continue;
+      REQUIRE(entry.second == min_count);
+      ++num_replaced;
+    }
+    REQUIRE(num_replaced == 1);
+  }
+}
+
+// Adds random communities (a few frequent ones among many rare ones), tracking true counts
+void AddRandomCommunities(
+  community_set_t& community_set,
+  std::map<emp::vector<double>, size_t>& true_counts,
+  emp::Random& random,
+  size_t num_adds
+) {
+  for (size_t step = 0; step < num_adds; ++step) {
+    emp::vector<double> counts(2);
+    if (random.P(0.5)) {
+      counts[0] = (double)random.GetUInt(3);
+    } else {
+      counts[0] = (double)(3 + random.GetUInt(500));
+      counts[1] = (double)random.GetUInt(5);
+    }
+    community_set.Add(MakeSummary(counts));
+    ++true_counts[counts];
+  }
+}
+
+TEST_CASE("RecordedCommunitySet Merge should match adding communities one-by-one") {
+  emp::Random random(5);
+
+  SECTION("exact sets") {
+    community_set_t merged_set(counts_key_fun);
+    community_set_t added_set(counts_key_fun);
+    std::map<emp::vector<double>, size_t> expected;
+    for (size_t part = 0; part < 3; ++part) {
+      community_set_t part_set(counts_key_fun);
+      for (size_t step = 0; step < 200; ++step) {
+        emp::vector<double> counts(2);
+        counts[0] = (double)random.GetUInt(20);
+        const size_t count = 1 + random.GetUInt(3);
+        part_set.Add(MakeSummary(counts), count);
+        expected[counts] += count;
+      }
+      for (size_t id = 0; id < part_set.GetSize(); ++id) {
+        added_set.Add(part_set.GetCommunitySummary(id), part_set.GetCommunityCount(id));
+      }
+      merged_set.Merge(part_set);
+    }
+    VerifySet(merged_set, expected);
+    // Same IDs as adding the summaries one-by-one
+    REQUIRE(merged_set.GetSize() == added_set.GetSize());
+    for (size_t id = 0; id < merged_set.GetSize(); ++id) {
+      REQUIRE(added_set.GetCommunityID(merged_set.GetCommunitySummary(id)) == std::optional<size_t>{id});
+    }
+  }
+
+  SECTION("bounded sets") {
+    std::map<emp::vector<double>, size_t> true_counts;
+    community_set_t set_a(counts_key_fun);
+    community_set_t set_b(counts_key_fun);
+    set_a.SetCapacity(10);
+    set_b.SetCapacity(10);
+    AddRandomCommunities(set_a, true_counts, random, 5000);
+    AddRandomCommunities(set_b, true_counts, random, 5000);
+    REQUIRE(set_a.GetUntrackedCount() > 0);
+
+    // Same sketch width (sketches are combined), different width, and no capacity
+    community_set_t same_width(counts_key_fun);
+    same_width.SetCapacity(10);
+    community_set_t other_width(counts_key_fun);
+    other_width.SetCapacity(10, 16);
+    community_set_t unbounded(counts_key_fun);
+    for (community_set_t* merged_set : {&same_width, &other_width, &unbounded}) {
+      merged_set->Merge(set_a);
+      merged_set->Merge(set_b);
+      REQUIRE(merged_set->GetTotalCount() == 10000);
+      size_t tracked_lower_bound = 0;
+      for (size_t id = 0; id < merged_set->GetSize(); ++id) {
+        const auto& summary = merged_set->GetCommunitySummary(id);
+        const size_t count = merged_set->GetCommunityCount(id);
+        const size_t error = merged_set->GetCountError(id);
+        const size_t true_count = true_counts[emp::vector<double>(summary.counts.begin(), summary.counts.end())];
+        REQUIRE(true_count <= count);
+        REQUIRE(true_count + error >= count);
+        tracked_lower_bound += count - error;
+      }
+      REQUIRE(merged_set->GetUntrackedCount() == 10000 - tracked_lower_bound);
+    }
+    // Nothing is dropped from an unbounded set, so only other sets' untracked counts are untracked
+    REQUIRE(unbounded.GetUntrackedCount() == set_a.GetUntrackedCount() + set_b.GetUntrackedCount());
+
+    // Removing a community only takes the part of its count known to be its own out of the total
+    for (size_t id = 0; id < set_a.GetSize(); ++id) {
+      if (set_a.GetCountError(id) == 0) continue;
+      const size_t untracked_count = set_a.GetUntrackedCount();
+      const size_t total_count = set_a.GetTotalCount();
+      const size_t known_count = set_a.GetCommunityCount(id) - set_a.GetCountError(id);
+      set_a.Remove(set_a.GetCommunitySummary(id));
+      REQUIRE(set_a.GetTotalCount() == total_count - known_count);
+      REQUIRE(set_a.GetUntrackedCount() == untracked_count);
+      break;
+    }
+  }
+}
+
+TEST_CASE("SmallVector should behave like a vector whether stored inline or on the heap") {
+  using small_vector_t = chemical_ecology::utils::SmallVector<double, 4>;
+  for (size_t size : {0, 3, 4, 5, 20}) {
+    emp::vector<double> values(size);
+    for (size_t i = 0; i < size; ++i) values[i] = (double)i + 0.5;
+    small_vector_t small_values(values.begin(), values.end());
+    REQUIRE(small_values.size() == size);
+    REQUIRE(emp::vector<double>(small_values.begin(), small_values.end()) == values);
+
+    small_vector_t copied(small_values);
+    REQUIRE(copied == small_values);
+    small_vector_t moved(std::move(copied));
+    REQUIRE(moved == small_values);
+    copied = moved;
+    REQUIRE(copied == small_values);
+
+    // Growing keeps existing values
+    moved.resize(size + 3, -1.0);
+    REQUIRE(moved.size() == size + 3);
+    for (size_t i = 0; i < size; ++i) REQUIRE(moved[i] == values[i]);
+    REQUIRE(moved[size + 2] == -1.0);
+    REQUIRE(small_values < moved);
+    REQUIRE(moved != small_values);
+
+    std::stringstream stream;
+    chemical_ecology::utils::WriteBinary(stream, small_values);
+    small_vector_t loaded;
+    REQUIRE(chemical_ecology::utils::ReadBinary(stream, loaded));
+    REQUIRE(loaded == small_values);
+  }
+}
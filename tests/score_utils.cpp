@@ -0,0 +1,32 @@
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include <cmath>
+
+#include "chemical-ecology/utils/score_utils.hpp"
+
+TEST_CASE("CountLoggedScoreTerms should match the logged multiplicative score's accumulated steps") {
+  // Known values where accumulated steps differ from ceil(world_prop / 0.01)
+  REQUIRE(chemical_ecology::utils::CountLoggedScoreTerms(0.07) == 7);
+  REQUIRE(chemical_ecology::utils::CountLoggedScoreTerms(0.1) == 11);
+  REQUIRE(chemical_ecology::utils::CountLoggedScoreTerms(0.28) == 28);
+  REQUIRE(chemical_ecology::utils::CountLoggedScoreTerms(0.0) == 0);
+
+  // Sweep world proportions (counts out of a range of world sizes), comparing with the
+  // loop the score has always used
+  for (size_t num_cells = 1; num_cells <= 400; ++num_cells) {
+    for (size_t count = 0; count <= num_cells; ++count) {
+      const double world_prop = (double)count / (double)num_cells;
+      const size_t num_terms = chemical_ecology::utils::CountLoggedScoreTerms(world_prop);
+      const double log_prop = std::log(0.25);
+      double summed = 0;
+      for (size_t term = 0; term < num_terms; ++term) summed += log_prop;
+      double expected_summed = 0;
+      for (double j = 0.0; j < world_prop; j += .01) {
+        expected_summed += std::log(0.25);
+      }
+      REQUIRE(summed == expected_summed);
+    }
+  }
+}